@@ -689,6 +689,7 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
         // Minecraft mods
         m_settings->registerSetting("ModMetadataDisabled", false);
         m_settings->registerSetting("ModDependenciesDisabled", false);
+        m_settings->registerSetting("ModMetadataCache", true);
         m_settings->registerSetting("SkipModpackUpdatePrompt", false);
 
         // Minecraft offline player name
@@ -765,6 +766,16 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
             if (!metaUrl.isValid() || (metaUrl.scheme() != "http" && metaUrl.scheme() != "https"))
                 m_settings->reset("MetaURLOverride");
         }
+        {
+            // Modrinth and CurseForge API URLs, mostly for pointing them at a mock server
+            for (auto setting : { "ModrinthAPIURLOverride", "FlameAPIURLOverride" }) {
+                m_settings->registerSetting(setting, "");
+
+                QUrl apiUrl(m_settings->get(setting).toString());
+                if (!apiUrl.isValid() || (apiUrl.scheme() != "http" && apiUrl.scheme() != "https"))
+                    m_settings->reset(setting);
+            }
+        }
 
         m_settings->registerSetting("CloseAfterLaunch", false);
         m_settings->registerSetting("QuitAfterGameStop", false);
@@ -865,6 +876,8 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
         }
         m_instances.reset(new InstanceList(m_settings, instDir, this));
         connect(InstDirSetting.get(), &Setting::SettingChanged, m_instances.get(), &InstanceList::on_InstFolderChanged);
+        // Custom icons are decoded in the background, so the instance view needs to know when they're in
+        connect(m_icons.get(), &IconList::iconUpdated, m_instances.get(), &InstanceList::iconUpdated);
         qDebug() << "Loading Instances...";
         m_instances->loadList();
         qDebug() << "<> Instances loaded.";
@@ -926,6 +939,9 @@ Application::Application(int& argc, char** argv) : QApplication(argc, argv)
             // save any remaining instance state
             m_instances->saveNow();
         }
+        if (m_settings) {
+            m_settings->flush();
+        }
         if (logFile) {
             logFile->flush();
             logFile->close();
@@ -58,11 +58,11 @@ BaseInstance::BaseInstance(SettingsObjectPtr globalSettings, SettingsObjectPtr s
     m_global_settings = globalSettings;
     m_rootDir = rootDir;
 
-    m_settings->registerSetting("name", "Unnamed Instance");
-    m_settings->registerSetting("iconKey", "default");
+    m_name = CachedSetting<QString>(m_settings->registerSetting("name", "Unnamed Instance"));
+    m_iconKey = CachedSetting<QString>(m_settings->registerSetting("iconKey", "default"));
     m_settings->registerSetting("notes", "");
 
-    m_settings->registerSetting("lastLaunchTime", 0);
+    m_lastLaunch = CachedSetting<qint64>(m_settings->registerSetting("lastLaunchTime", 0));
     m_settings->registerSetting("totalTimePlayed", 0);
     if (m_settings->get("totalTimePlayed").toLongLong() < 0)
         m_settings->reset("totalTimePlayed");
@@ -346,7 +346,7 @@ bool BaseInstance::reloadSettings()
 
 qint64 BaseInstance::lastLaunch() const
 {
-    return m_settings->get("lastLaunchTime").value<qint64>();
+    return m_lastLaunch.get();
 }
 
 void BaseInstance::setLastLaunch(qint64 val)
@@ -376,7 +376,7 @@ void BaseInstance::setIconKey(QString val)
 
 QString BaseInstance::iconKey() const
 {
-    return m_settings->get("iconKey").toString();
+    return m_iconKey.get();
 }
 
 void BaseInstance::setName(QString val)
@@ -388,7 +388,7 @@ void BaseInstance::setName(QString val)
 
 QString BaseInstance::name() const
 {
-    return m_settings->get("name").toString();
+    return m_name.get();
 }
 
 QString BaseInstance::windowTitle() const
@@ -45,6 +45,7 @@
 #include <QSet>
 #include "QObjectPtr.h"
 
+#include "settings/CachedSetting.h"
 #include "settings/SettingsObject.h"
 
 #include "BaseVersionList.h"
@@ -313,6 +314,11 @@ class BaseInstance : public QObject, public std::enable_shared_from_this<BaseIns
 
     SettingsObjectWeakPtr m_global_settings;
     bool m_specific_settings_loaded = false;
+
+    // read for every instance whenever the instance list is sorted or painted
+    CachedSetting<QString> m_name;
+    CachedSetting<QString> m_iconKey;
+    CachedSetting<qint64> m_lastLaunch;
 };
 
 Q_DECLARE_METATYPE(shared_qobject_ptr<BaseInstance>)
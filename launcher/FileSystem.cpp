@@ -45,10 +45,13 @@
 #include <QDirIterator>
 #include <QFile>
 #include <QFileInfo>
+#include <QMutex>
+#include <QSet>
 #include <QStandardPaths>
 #include <QStorageInfo>
 #include <QTextStream>
 #include <QUrl>
+#include <QtConcurrent>
 #include <QtNetwork>
 #include <system_error>
 
@@ -102,6 +105,8 @@ namespace fs = ghc::filesystem;
 #include <fcntl.h> /* Definition of FICLONE* constants */
 #include <linux/fs.h>
 #include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #elif defined(Q_OS_MACOS)
 #include <sys/attr.h>
@@ -319,6 +324,7 @@ bool copy::operator()(const QString& offset, bool dryRun)
 {
     using copy_opts = fs::copy_options;
     m_copied = 0;  // reset counter
+    m_totalBytes = 0;
     m_failedPaths.clear();
 
 // NOTE always deep copy on windows. the alternatives are too messy.
@@ -341,10 +347,12 @@ bool copy::operator()(const QString& offset, bool dryRun)
         opt |= copy_opts::overwrite_existing;
 
     // Function that'll do the actual copying
-    auto copy_file = [this, dryRun, src, dst, opt, &err](QString src_path, QString relative_dst_path) {
+    auto copy_file = [this, dryRun, src, dst, opt, &err](QString src_path, QString relative_dst_path, qint64 size) {
         if (m_matcher && (m_matcher->matches(relative_dst_path) != m_whitelist))
             return;
 
+        m_totalBytes += size;
+
         auto dst_path = PathCombine(dst, relative_dst_path);
         if (!dryRun) {
             ensureFilePathExists(dst_path);
@@ -363,6 +371,7 @@ bool copy::operator()(const QString& offset, bool dryRun)
         }
         m_copied++;
         emit fileCopied(relative_dst_path);
+        emit bytesCopied(size);
     };
 
     // We can't use copy_opts::recursive because we need to take into account the
@@ -375,12 +384,12 @@ bool copy::operator()(const QString& offset, bool dryRun)
         auto src_path = source_it.next();
         auto relative_path = src_dir.relativeFilePath(src_path);
 
-        copy_file(src_path, relative_path);
+        copy_file(src_path, relative_path, source_it.fileInfo().size());
     }
 
     // If the root src is not a directory, the previous iterator won't run.
     if (!fs::is_directory(StringUtils::toStdString(src)))
-        copy_file(src, "");
+        copy_file(src, "", QFileInfo(src).size());
 
     return err.value() == 0;
 }
@@ -1271,6 +1280,14 @@ bool canClone(const QString& src, const QString& dst)
     return sameDevice && canCloneOnFS(srcVInfo) && canCloneOnFS(dstVInfo);
 }
 
+struct CloneJob {
+    QString src;
+    QString dst;
+    qint64 size;
+};
+
+static bool clone_file_native(const StringUtils::string& src_path, const StringUtils::string& dst_path, std::error_code& ec);
+
 /**
  * @brief reflink/clones a directory and it's contents from src to dest
  * @param offset subdirectory form src to copy to dest
@@ -1278,47 +1295,39 @@ bool canClone(const QString& src, const QString& dst)
  */
 bool clone::operator()(const QString& offset, bool dryRun)
 {
-    if (!canClone(m_src.absolutePath(), m_dst.absolutePath())) {
+    bool cloneable = canClone(m_src.absolutePath(), m_dst.absolutePath());
+    if (!cloneable && !m_fallbackToCopy) {
         qWarning() << "Can not clone: not same device or not clone/reflink filesystem";
         qDebug() << "Source path:" << m_src.absolutePath();
         qDebug() << "Destination path:" << m_dst.absolutePath();
         emit cloneFailed(m_src.absolutePath(), m_dst.absolutePath());
         return false;
     }
+    if (!cloneable)
+        qDebug() << "Can not clone" << m_src.absolutePath() << "to" << m_dst.absolutePath() << "falling back to copying";
 
     m_cloned = 0;  // reset counter
+    m_totalBytes = 0;
     m_failedClones.clear();
 
     auto src = PathCombine(m_src.absolutePath(), offset);
     auto dst = PathCombine(m_dst.absolutePath(), offset);
 
-    std::error_code err;
-
-    // Function that'll do the actual cloneing
-    auto cloneFile = [this, dryRun, dst, &err](QString src_path, QString relative_dst_path) {
+    // We can't use copy_opts::recursive because we need to take into account the
+    // blacklisted paths, so we iterate over the source directory, and if there's no blacklist
+    // match, we queue the file.
+    QList<CloneJob> jobs;
+    QSet<QString> dstDirs;
+    auto queueFile = [this, dst, &jobs, &dstDirs](QString src_path, QString relative_dst_path, qint64 size) {
         if (m_matcher && (m_matcher->matches(relative_dst_path) != m_whitelist))
             return;
 
         auto dst_path = PathCombine(dst, relative_dst_path);
-        if (!dryRun) {
-            ensureFilePathExists(dst_path);
-            clone_file(src_path, dst_path, err);
-        }
-        if (err) {
-            qDebug() << "Failed to clone files: error" << err.value() << "message" << QString::fromStdString(err.message());
-            qDebug() << "Source file:" << src_path;
-            qDebug() << "Destination file:" << dst_path;
-            m_failedClones.append(qMakePair(src_path, dst_path));
-            emit cloneFailed(src_path, dst_path);
-            return;
-        }
-        m_cloned++;
-        emit fileCloned(src_path, dst_path);
+        dstDirs.insert(QFileInfo(dst_path).absolutePath());
+        jobs.append({ src_path, dst_path, size });
+        m_totalBytes += size;
     };
 
-    // We can't use copy_opts::recursive because we need to take into account the
-    // blacklisted paths, so we iterate over the source directory, and if there's no blacklist
-    // match, we copy the file.
     QDir src_dir(src);
     QDirIterator source_it(src, QDir::Filter::Files | QDir::Filter::Hidden, QDirIterator::Subdirectories);
 
@@ -1326,14 +1335,60 @@ bool clone::operator()(const QString& offset, bool dryRun)
         auto src_path = source_it.next();
         auto relative_path = src_dir.relativeFilePath(src_path);
 
-        cloneFile(src_path, relative_path);
+        queueFile(src_path, relative_path, source_it.fileInfo().size());
     }
 
     // If the root src is not a directory, the previous iterator won't run.
     if (!fs::is_directory(StringUtils::toStdString(src)))
-        cloneFile(src, "");
+        queueFile(src, "", QFileInfo(src).size());
 
-    return err.value() == 0;
+    if (dryRun) {
+        m_cloned = jobs.size();
+        return true;
+    }
+
+    // create the directory tree up front so the workers don't race each other on mkpath
+    for (auto& dir : dstDirs)
+        ensureFolderPathExists(dir);
+
+    QMutex resultLock;
+    bool success = true;
+
+    // Function that'll do the actual cloneing
+    auto cloneFile = [this, cloneable, &resultLock, &success](const CloneJob& job) {
+        auto src_path = StringUtils::toStdString(QDir::toNativeSeparators(job.src));
+        auto dst_path = StringUtils::toStdString(QDir::toNativeSeparators(job.dst));
+
+        std::error_code err;
+        bool done = cloneable && clone_file_native(src_path, dst_path, err);
+        if (!done && m_fallbackToCopy) {
+            err.clear();
+            done = copy_file_contents(job.src, job.dst, err);
+        }
+
+        QMutexLocker locker(&resultLock);
+        if (!done) {
+            qDebug() << "Failed to clone files: error" << err.value() << "message" << QString::fromStdString(err.message());
+            qDebug() << "Source file:" << job.src;
+            qDebug() << "Destination file:" << job.dst;
+            m_failedClones.append(qMakePair(job.src, job.dst));
+            success = false;
+            emit cloneFailed(job.src, job.dst);
+            return;
+        }
+        m_cloned++;
+        emit fileCloned(job.src, job.dst);
+        emit bytesCloned(job.size);
+    };
+
+    if (m_parallel) {
+        QtConcurrent::blockingMap(jobs, cloneFile);
+    } else {
+        for (auto& job : jobs)
+            cloneFile(job);
+    }
+
+    return success;
 }
 
 /**
@@ -1354,6 +1409,15 @@ bool clone_file(const QString& src, const QString& dst, std::error_code& ec)
         return false;
     }
 
+    return clone_file_native(src_path, dst_path, ec);
+}
+
+/**
+ * @brief clone/reflink file from src to dst without checking the filesystems first
+ *
+ */
+static bool clone_file_native(const StringUtils::string& src_path, const StringUtils::string& dst_path, std::error_code& ec)
+{
 #if defined(Q_OS_WIN)
 
     if (!win_ioctl_clone(src_path, dst_path, ec)) {
@@ -1388,6 +1452,23 @@ bool clone_file(const QString& src, const QString& dst, std::error_code& ec)
     return true;
 }
 
+/**
+ * @brief copy the contents of src into dst, letting the kernel do the copy where possible
+ *
+ */
+bool copy_file_contents(const QString& src, const QString& dst, std::error_code& ec)
+{
+    auto src_path = StringUtils::toStdString(QDir::toNativeSeparators(QFileInfo(src).absoluteFilePath()));
+    auto dst_path = StringUtils::toStdString(QDir::toNativeSeparators(QFileInfo(dst).absoluteFilePath()));
+
+#if defined(Q_OS_LINUX)
+    return linux_copy_file_range(src_path, dst_path, ec);
+#else
+    // the standard library already uses the platform's native copy routine (CopyFileW, copyfile, ...)
+    return fs::copy_file(src_path, dst_path, fs::copy_options::overwrite_existing, ec);
+#endif
+}
+
 #if defined(Q_OS_WIN)
 
 static long RoundUpToPowerOf2(long originalValue, long roundingMultiplePowerOf2)
@@ -1599,6 +1680,78 @@ bool linux_ficlone(const std::string& src_path, const std::string& dst_path, std
     return true;
 }
 
+bool linux_copy_file_range(const std::string& src_path, const std::string& dst_path, std::error_code& ec)
+{
+    // https://man7.org/linux/man-pages/man2/copy_file_range.2.html
+    // https://man7.org/linux/man-pages/man2/sendfile.2.html
+
+    int src_fd = open(src_path.c_str(), O_RDONLY);
+    if (src_fd == -1) {
+        qDebug() << "Failed to open file:" << src_path.c_str();
+        qDebug() << "Error:" << strerror(errno);
+        ec = std::make_error_code(static_cast<std::errc>(errno));
+        return false;
+    }
+    struct stat src_stat;
+    if (fstat(src_fd, &src_stat) == -1) {
+        qDebug() << "Failed to stat file:" << src_path.c_str();
+        qDebug() << "Error:" << strerror(errno);
+        ec = std::make_error_code(static_cast<std::errc>(errno));
+        close(src_fd);
+        return false;
+    }
+    int dst_fd = open(dst_path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, src_stat.st_mode & 07777);
+    if (dst_fd == -1) {
+        qDebug() << "Failed to open file:" << dst_path.c_str();
+        qDebug() << "Error:" << strerror(errno);
+        ec = std::make_error_code(static_cast<std::errc>(errno));
+        close(src_fd);
+        return false;
+    }
+
+    // copy_file_range keeps the data in the kernel (and may still share extents on some filesystems),
+    // sendfile is the fallback for kernels / filesystem pairs that don't support it
+    bool use_sendfile = false;
+    off_t remaining = src_stat.st_size;
+    while (remaining > 0) {
+        ssize_t copied;
+        if (!use_sendfile) {
+            copied = copy_file_range(src_fd, nullptr, dst_fd, nullptr, remaining, 0);
+            if (copied == -1 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+                use_sendfile = true;
+                continue;
+            }
+        } else {
+            copied = sendfile(dst_fd, src_fd, nullptr, remaining);
+        }
+        if (copied == -1) {
+            if (errno == EINTR)
+                continue;
+            qDebug() << "Failed to copy file:" << src_path.c_str() << "to" << dst_path.c_str();
+            qDebug() << "Error:" << strerror(errno);
+            ec = std::make_error_code(static_cast<std::errc>(errno));
+            close(src_fd);
+            close(dst_fd);
+            return false;
+        }
+        if (copied == 0)  // the source shrunk while we were copying it
+            break;
+        remaining -= copied;
+    }
+
+    if (close(src_fd)) {
+        qDebug() << "Failed to close file:" << src_path.c_str();
+        qDebug() << "Error:" << strerror(errno);
+    }
+    if (close(dst_fd)) {
+        qDebug() << "Failed to close file:" << dst_path.c_str();
+        qDebug() << "Error:" << strerror(errno);
+        ec = std::make_error_code(static_cast<std::errc>(errno));
+        return false;
+    }
+    return true;
+}
+
 #elif defined(Q_OS_MACOS)
 
 bool macos_bsd_clonefile(const std::string& src_path, const std::string& dst_path, std::error_code& ec)
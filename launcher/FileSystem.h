@@ -136,9 +136,12 @@ class copy : public QObject {
     qsizetype totalCopied() { return m_copied; }
     qsizetype totalFailed() { return m_failedPaths.length(); }
     QStringList failed() { return m_failedPaths; }
+    /// total size in bytes of the files matched by the last run (dry or not)
+    qint64 totalBytes() { return m_totalBytes; }
 
    signals:
     void fileCopied(const QString& relativeName);
+    void bytesCopied(qint64 bytes);
     void copyFailed(const QString& relativeName);
     // TODO: maybe add a "shouldCopy" signal in the future?
 
@@ -153,6 +156,7 @@ class copy : public QObject {
     QDir m_src;
     QDir m_dst;
     qsizetype m_copied;
+    qint64 m_totalBytes = 0;
     QStringList m_failedPaths;
 };
 
@@ -498,16 +502,32 @@ class clone : public QObject {
         m_whitelist = whitelist;
         return *this;
     }
+    /// copy the file contents (copy_file_range/sendfile where available) when a reflink is not possible
+    clone& fallbackToCopy(bool fallback)
+    {
+        m_fallbackToCopy = fallback;
+        return *this;
+    }
+    /// clone files on the global thread pool instead of one at a time
+    clone& parallel(bool parallel)
+    {
+        m_parallel = parallel;
+        return *this;
+    }
 
     bool operator()(bool dryRun = false) { return operator()(QString(), dryRun); }
 
     qsizetype totalCloned() { return m_cloned; }
     qsizetype totalFailed() { return m_failedClones.length(); }
+    /// total size in bytes of the files matched by the last run (dry or not)
+    qint64 totalBytes() { return m_totalBytes; }
 
     QList<QPair<QString, QString>> failed() { return m_failedClones; }
 
    signals:
+    // NOTE: when running in parallel these are emitted from worker threads, but never concurrently
     void fileCloned(const QString& src, const QString& dst);
+    void bytesCloned(qint64 bytes);
     void cloneFailed(const QString& src, const QString& dst);
 
    private:
@@ -516,9 +536,12 @@ class clone : public QObject {
    private:
     const IPathMatcher* m_matcher = nullptr;
     bool m_whitelist = false;
+    bool m_fallbackToCopy = false;
+    bool m_parallel = false;
     QDir m_src;
     QDir m_dst;
     qsizetype m_cloned;
+    qint64 m_totalBytes = 0;
     QList<QPair<QString, QString>> m_failedClones;
 };
 
@@ -528,10 +551,17 @@ class clone : public QObject {
  */
 bool clone_file(const QString& src, const QString& dst, std::error_code& ec);
 
+/**
+ * @brief copy the contents of src into dst, letting the kernel do the copy where possible
+ *
+ */
+bool copy_file_contents(const QString& src, const QString& dst, std::error_code& ec);
+
 #if defined(Q_OS_WIN)
 bool win_ioctl_clone(const std::wstring& src_path, const std::wstring& dst_path, std::error_code& ec);
 #elif defined(Q_OS_LINUX)
 bool linux_ficlone(const std::string& src_path, const std::string& dst_path, std::error_code& ec);
+bool linux_copy_file_range(const std::string& src_path, const std::string& dst_path, std::error_code& ec);
 #elif defined(Q_OS_MACOS) || defined(Q_OS_FREEBSD) || defined(Q_OS_OPENBSD)
 bool macos_bsd_clonefile(const std::string& src_path, const std::string& dst_path, std::error_code& ec);
 #endif
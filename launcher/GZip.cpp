@@ -36,6 +36,29 @@
 #include "GZip.h"
 #include <zlib.h>
 #include <QByteArray>
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+// How much compressed data the streaming reader pulls from its source, and how much the writer hands to its target, at once
+static constexpr int s_chunk_size = 64 * 1024;
+
+// Deflate can't do better than about 1032:1, so any bigger size hint is from a broken or hostile file
+static constexpr qint64 s_max_ratio = 1032;
+// The size hint is only believed up to this much, or this many times the compressed size, whichever is bigger. Anything
+// past that grows the output as it gets inflated, so a file lying about its size can't make us allocate a lot up front.
+static constexpr qint64 s_max_prealloc = 8 * 1024 * 1024;
+static constexpr qint64 s_max_prealloc_ratio = 16;
+
+qint64 GZip::sizeHint(const QByteArray& compressedBytes)
+{
+    // 10 bytes of header and 8 of trailer, at the very least
+    if (compressedBytes.size() < 18)
+        return -1;
+    return qFromLittleEndian<quint32>(compressedBytes.constData() + compressedBytes.size() - 4);
+}
 
 bool GZip::unzip(const QByteArray& compressedBytes, QByteArray& uncompressedBytes)
 {
@@ -44,7 +67,16 @@ bool GZip::unzip(const QByteArray& compressedBytes, QByteArray& uncompressedByte
         return true;
     }
 
-    unsigned uncompLength = compressedBytes.size();
+    // With a believable size from the trailer the output gets allocated once, and inflated in a single call
+    qint64 uncompLength = compressedBytes.size();
+    auto hint = sizeHint(compressedBytes);
+    bool single_shot = false;
+    if (hint > 0 && hint <= compressedBytes.size() * s_max_ratio && hint < std::numeric_limits<int>::max()) {
+        auto limit = std::max<qint64>(s_max_prealloc, compressedBytes.size() * s_max_prealloc_ratio);
+        single_shot = hint <= limit;
+        uncompLength = std::min(hint, limit);
+    }
+
     uncompressedBytes.clear();
     uncompressedBytes.resize(uncompLength);
 
@@ -59,22 +91,29 @@ bool GZip::unzip(const QByteArray& compressedBytes, QByteArray& uncompressedByte
         return false;
     }
 
+    // Z_FINISH lets zlib skip setting up its sliding window when everything fits. If the hint was wrong, it returns
+    // Z_BUF_ERROR and carries on like Z_NO_FLUSH once there is more room.
+    int flush = single_shot ? Z_FINISH : Z_SYNC_FLUSH;
     int err = Z_OK;
 
     while (!done) {
         // If our output buffer is too small
         if (strm.total_out >= uncompLength) {
-            uncompressedBytes.resize(uncompLength * 2);
+            if (uncompLength * 2 >= std::numeric_limits<int>::max())
+                break;
             uncompLength *= 2;
+            uncompressedBytes.resize(uncompLength);
         }
 
         strm.next_out = reinterpret_cast<Bytef*>((uncompressedBytes.data() + strm.total_out));
         strm.avail_out = uncompLength - strm.total_out;
 
         // Inflate another chunk.
-        err = inflate(&strm, Z_SYNC_FLUSH);
+        err = inflate(&strm, flush);
         if (err == Z_STREAM_END)
             done = true;
+        else if (err == Z_BUF_ERROR && flush == Z_FINISH && strm.avail_out == 0)
+            flush = Z_SYNC_FLUSH;
         else if (err != Z_OK) {
             break;
         }
@@ -95,10 +134,6 @@ bool GZip::zip(const QByteArray& uncompressedBytes, QByteArray& compressedBytes)
         return true;
     }
 
-    unsigned compLength = qMin(uncompressedBytes.size(), 16);
-    compressedBytes.clear();
-    compressedBytes.resize(compLength);
-
     z_stream zs;
     memset(&zs, 0, sizeof(zs));
 
@@ -110,7 +145,9 @@ bool GZip::zip(const QByteArray& uncompressedBytes, QByteArray& compressedBytes)
     zs.avail_in = uncompressedBytes.size();
 
     int ret;
-    compressedBytes.resize(uncompressedBytes.size());
+    // deflateBound covers the worst case, gzip wrapper included, so this normally takes a single deflate call
+    compressedBytes.clear();
+    compressedBytes.resize(deflateBound(&zs, uncompressedBytes.size()));
 
     unsigned offset = 0;
     unsigned temp = 0;
@@ -136,3 +173,175 @@ bool GZip::zip(const QByteArray& uncompressedBytes, QByteArray& compressedBytes)
     }
     return true;
 }
+
+GZipReader::GZipReader(QIODevice* source, QObject* parent) : QIODevice(parent), m_source(source), m_strm(new z_stream) {}
+
+GZipReader::~GZipReader()
+{
+    close();
+}
+
+bool GZipReader::open(OpenMode mode)
+{
+    if ((mode & WriteOnly) || !m_source->isReadable()) {
+        setErrorString("A gzip reader can only be opened for reading, on a readable source");
+        return false;
+    }
+
+    memset(m_strm.get(), 0, sizeof(z_stream));
+    if (inflateInit2(m_strm.get(), (16 + MAX_WBITS)) != Z_OK) {
+        setErrorString("Could not initialize zlib");
+        return false;
+    }
+    m_input.resize(s_chunk_size);
+    m_finished = false;
+    return QIODevice::open(mode);
+}
+
+void GZipReader::close()
+{
+    if (!isOpen())
+        return;
+    QIODevice::close();
+    inflateEnd(m_strm.get());
+}
+
+bool GZipReader::atEnd() const
+{
+    return m_finished && QIODevice::atEnd();
+}
+
+qint64 GZipReader::readData(char* data, qint64 maxSize)
+{
+    auto strm = m_strm.get();
+    strm->next_out = reinterpret_cast<Bytef*>(data);
+    strm->avail_out = static_cast<uInt>(qMin<qint64>(maxSize, std::numeric_limits<uInt>::max()));
+    const auto capacity = strm->avail_out;
+
+    // Stop at the first bit of output, like a socket would, so small reads don't wait on a whole buffer
+    while (capacity > 0 && strm->avail_out == capacity && !m_finished) {
+        if (strm->avail_in == 0) {
+            auto read = m_source->read(m_input.data(), m_input.size());
+            if (read < 0) {
+                setErrorString(m_source->errorString());
+                return -1;
+            }
+            if (read == 0) {
+                if (!m_source->atEnd())
+                    break;
+                setErrorString("Unexpected end of gzip data");
+                return -1;
+            }
+            strm->next_in = reinterpret_cast<Bytef*>(m_input.data());
+            strm->avail_in = static_cast<uInt>(read);
+        }
+
+        auto err = inflate(strm, Z_NO_FLUSH);
+        if (err == Z_STREAM_END) {
+            m_finished = true;
+        } else if (err != Z_OK && err != Z_BUF_ERROR) {
+            setErrorString(strm->msg ? QString::fromUtf8(strm->msg) : QString("Corrupted gzip data"));
+            return -1;
+        }
+    }
+
+    return capacity - strm->avail_out;
+}
+
+qint64 GZipReader::writeData(const char*, qint64)
+{
+    return -1;
+}
+
+GZipWriter::GZipWriter(QIODevice* target, int level, QObject* parent)
+    : QIODevice(parent), m_target(target), m_level(level), m_strm(new z_stream)
+{}
+
+GZipWriter::~GZipWriter()
+{
+    close();
+}
+
+bool GZipWriter::open(OpenMode mode)
+{
+    if ((mode & ReadOnly) || !m_target->isWritable()) {
+        setErrorString("A gzip writer can only be opened for writing, on a writable target");
+        return false;
+    }
+
+    memset(m_strm.get(), 0, sizeof(z_stream));
+    if (deflateInit2(m_strm.get(), m_level, Z_DEFLATED, (16 + MAX_WBITS), 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        setErrorString("Could not initialize zlib");
+        return false;
+    }
+    m_output.resize(s_chunk_size);
+    m_failed = false;
+    return QIODevice::open(mode | Unbuffered);
+}
+
+void GZipWriter::close()
+{
+    finish();
+}
+
+bool GZipWriter::finish()
+{
+    if (!isOpen())
+        return !m_failed;
+
+    if (!m_failed)
+        m_failed = !deflateInput(Z_FINISH);
+    QIODevice::close();
+    deflateEnd(m_strm.get());
+    return !m_failed;
+}
+
+qint64 GZipWriter::readData(char*, qint64)
+{
+    return -1;
+}
+
+qint64 GZipWriter::writeData(const char* data, qint64 maxSize)
+{
+    if (m_failed)
+        return -1;
+
+    auto strm = m_strm.get();
+    qint64 written = 0;
+    while (written < maxSize) {
+        auto count = static_cast<uInt>(qMin<qint64>(maxSize - written, std::numeric_limits<uInt>::max()));
+        strm->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data + written));
+        strm->avail_in = count;
+        if (!deflateInput(Z_NO_FLUSH)) {
+            m_failed = true;
+            return -1;
+        }
+        written += count;
+    }
+    return written;
+}
+
+bool GZipWriter::deflateInput(int flush)
+{
+    auto strm = m_strm.get();
+    while (true) {
+        strm->next_out = reinterpret_cast<Bytef*>(m_output.data());
+        strm->avail_out = m_output.size();
+
+        auto err = deflate(strm, flush);
+        if (err == Z_STREAM_ERROR) {
+            setErrorString("Could not compress the data");
+            return false;
+        }
+
+        qint64 have = m_output.size() - strm->avail_out;
+        if (have > 0 && m_target->write(m_output.constData(), have) != have) {
+            setErrorString(m_target->errorString());
+            return false;
+        }
+
+        // Without flushing, zlib is done once it stops filling the whole buffer. Finishing goes on until the trailer.
+        if (flush == Z_FINISH ? err == Z_STREAM_END : strm->avail_out != 0)
+            return true;
+    }
+}
@@ -1,8 +1,75 @@
 #pragma once
 #include <QByteArray>
+#include <QIODevice>
+
+#include <memory>
+
+struct z_stream_s;
 
 class GZip {
    public:
     static bool unzip(const QByteArray& compressedBytes, QByteArray& uncompressedBytes);
     static bool zip(const QByteArray& uncompressedBytes, QByteArray& compressedBytes);
+
+    /** Reads the uncompressed size gzip stores in the last four bytes of a stream (ISIZE).
+     *  That's only the size modulo 2^32, and only of the last member, so it's a hint and nothing more.
+     *  Returns -1 when the data is too short to hold a trailer. */
+    static qint64 sizeHint(const QByteArray& compressedBytes);
+};
+
+/** Sequential device that inflates a gzip stream read from another device, a chunk at a time.
+ *
+ *  The source needs to be open already, and has to outlive the reader. Reading past the end of the gzip stream just
+ *  returns no more data, while corrupted data makes reads fail with an error string set.
+ */
+class GZipReader : public QIODevice {
+   public:
+    explicit GZipReader(QIODevice* source, QObject* parent = nullptr);
+    ~GZipReader() override;
+
+    bool open(OpenMode mode) override;
+    void close() override;
+    bool isSequential() const override { return true; }
+    bool atEnd() const override;
+
+   protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+   private:
+    QIODevice* m_source;
+    std::unique_ptr<z_stream_s> m_strm;
+    QByteArray m_input;
+    bool m_finished = false;
+};
+
+/** Sequential device that deflates everything written to it into a gzip stream on another device.
+ *
+ *  The target needs to be open already, and has to outlive the writer. The gzip trailer only gets written on close(),
+ *  so check finish() when it matters whether all of it made it to the target.
+ */
+class GZipWriter : public QIODevice {
+   public:
+    explicit GZipWriter(QIODevice* target, int level = -1, QObject* parent = nullptr);
+    ~GZipWriter() override;
+
+    bool open(OpenMode mode) override;
+    void close() override;
+    bool isSequential() const override { return true; }
+
+    /** Flushes the rest of the stream and the trailer to the target. Returns false if any of it could not be written. */
+    bool finish();
+
+   protected:
+    qint64 readData(char* data, qint64 maxSize) override;
+    qint64 writeData(const char* data, qint64 maxSize) override;
+
+   private:
+    bool deflateInput(int flush);
+
+    QIODevice* m_target;
+    int m_level;
+    std::unique_ptr<z_stream_s> m_strm;
+    QByteArray m_output;
+    bool m_failed = false;
 };
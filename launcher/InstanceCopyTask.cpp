@@ -39,16 +39,21 @@ InstanceCopyTask::InstanceCopyTask(InstancePtr origInstance, const InstanceCopyP
 void InstanceCopyTask::executeTask()
 {
     setStatus(tr("Copying instance %1").arg(m_origInstance->name()));
+    // the copy should have the settings as they are now, not as they were last saved
+    m_origInstance->settings()->flush();
 
     m_copyFuture = QtConcurrent::run(QThreadPool::globalInstance(), [this] {
         if (m_useClone) {
             FS::clone folderClone(m_origInstance->instanceRoot(), m_stagingPath);
-            folderClone.matcher(m_matcher.get());
+            // files that can't be reflinked (e.g. another device) are copied in-kernel instead
+            folderClone.matcher(m_matcher.get()).fallbackToCopy(true).parallel(true);
 
             folderClone(true);
-            setProgress(0, folderClone.totalCloned());
-            connect(&folderClone, &FS::clone::fileCloned,
-                    [this](QString src, QString dst) { setProgress(m_progress + 1, m_progressTotal); });
+            // a reflink only needs metadata space, a copy needs it all
+            if (!FS::canClone(m_origInstance->instanceRoot(), m_stagingPath) && !hasFreeSpaceFor(folderClone.totalBytes()))
+                return false;
+            setProgress(0, folderClone.totalBytes());
+            connect(&folderClone, &FS::clone::bytesCloned, [this](qint64 bytes) { setProgress(m_progress + bytes, m_progressTotal); });
             return folderClone();
         }
         if (m_useLinks || m_useHardLinks) {
@@ -67,6 +72,8 @@ void InstanceCopyTask::executeTask()
                                                        FS::PathCombine(staging_mc_dir, "saves"));
                 savesCopy->followSymlinks(true);
                 (*savesCopy)(true);
+                if (!hasFreeSpaceFor(savesCopy->totalBytes()))
+                    return false;
                 setProgress(0, savesCopy->totalCopied());
                 connect(savesCopy.get(), &FS::copy::fileCopied, [this](QString src) { setProgress(m_progress + 1, m_progressTotal); });
             }
@@ -130,8 +137,10 @@ void InstanceCopyTask::executeTask()
         folderCopy.followSymlinks(false).matcher(m_matcher.get());
 
         folderCopy(true);
-        setProgress(0, folderCopy.totalCopied());
-        connect(&folderCopy, &FS::copy::fileCopied, [this](QString src) { setProgress(m_progress + 1, m_progressTotal); });
+        if (!hasFreeSpaceFor(folderCopy.totalBytes()))
+            return false;
+        setProgress(0, folderCopy.totalBytes());
+        connect(&folderCopy, &FS::copy::bytesCopied, [this](qint64 bytes) { setProgress(m_progress + bytes, m_progressTotal); });
         return folderCopy();
     });
     connect(&m_copyFutureWatcher, &QFutureWatcher<bool>::finished, this, &InstanceCopyTask::copyFinished);
@@ -139,11 +148,23 @@ void InstanceCopyTask::executeTask()
     m_copyFutureWatcher.setFuture(m_copyFuture);
 }
 
+bool InstanceCopyTask::hasFreeSpaceFor(qint64 bytes)
+{
+    auto info = FS::statFS(m_stagingPath);
+    if (info.bytesAvailable >= 0 && info.bytesAvailable < bytes) {
+        m_copyError = tr("Not enough free space to copy the instance: %1 MiB needed, %2 MiB available.")
+                          .arg(bytes / (1024 * 1024))
+                          .arg(info.bytesAvailable / (1024 * 1024));
+        return false;
+    }
+    return true;
+}
+
 void InstanceCopyTask::copyFinished()
 {
     auto successful = m_copyFuture.result();
     if (!successful) {
-        emitFailed(tr("Instance folder copy failed."));
+        emitFailed(m_copyError.isEmpty() ? tr("Instance folder copy failed.") : m_copyError);
         return;
     }
 
@@ -24,6 +24,9 @@ class InstanceCopyTask : public InstanceTask {
     void copyAborted();
 
    private:
+    //! Checks the staging filesystem can hold `bytes` more data. Sets m_copyError if it can't.
+    bool hasFreeSpaceFor(qint64 bytes);
+
     /* data */
     InstancePtr m_origInstance;
     QFuture<bool> m_copyFuture;
@@ -35,4 +38,5 @@ class InstanceCopyTask : public InstanceTask {
     bool m_copySaves = false;
     bool m_linkRecursively = false;
     bool m_useClone = false;
+    QString m_copyError;
 };
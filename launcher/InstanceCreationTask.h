@@ -41,6 +41,9 @@ class InstanceCreationTask : public InstanceTask {
 
     QStringList m_files_to_remove;
 
+    /** Staged override files that must not be applied over the instance being updated. */
+    QStringList m_overrides_to_skip;
+
    private:
     QString m_error_message;
 };
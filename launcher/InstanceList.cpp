@@ -60,6 +60,7 @@
 #include "NullInstance.h"
 #include "WatchLock.h"
 #include "minecraft/MinecraftInstance.h"
+#include "minecraft/WorldList.h"
 #include "settings/INISettingsObject.h"
 
 #ifdef Q_OS_WIN32
@@ -408,6 +409,10 @@ void InstanceList::deleteInstance(const InstanceId& id)
         return;
     }
 
+    // Caches kept for the instance outside of its folder have to go too
+    if (auto world_sizes = WorldList::sizeCachePath(id); !world_sizes.isEmpty())
+        QFile::remove(world_sizes);
+
     qDebug() << "Instance" << id << "has been deleted by the launcher.";
 }
 
@@ -533,6 +538,7 @@ void InstanceList::saveNow()
 {
     for (auto& item : m_instances) {
         item->saveNow();
+        item->settings()->flush();
     }
 }
 
@@ -621,6 +627,15 @@ void InstanceList::propertiesChanged(BaseInstance* inst)
     }
 }
 
+void InstanceList::iconUpdated(const QString& key)
+{
+    for (int i = 0; i < m_instances.count(); i++) {
+        auto icon_key = m_instances[i]->iconKey();
+        if (icon_key == key || (icon_key == "default" && key == "grass"))
+            emit dataChanged(index(i), index(i));
+    }
+}
+
 InstancePtr InstanceList::loadInstance(const InstanceId& id)
 {
     if (!m_groupsLoaded) {
@@ -162,6 +162,7 @@ class InstanceList : public QAbstractListModel {
    public slots:
     void on_InstFolderChanged(const Setting& setting, QVariant value);
     void on_GroupStateChanged(const QString& group, bool collapsed);
+    void iconUpdated(const QString& key);
 
    private slots:
     void propertiesChanged(BaseInstance* inst);
@@ -0,0 +1,459 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "JsonReader.h"
+
+#include <QJsonArray>
+#include <QJsonObject>
+
+#include <cmath>
+#include <cstring>
+
+namespace Json {
+// same as QJsonDocument
+static constexpr std::size_t s_max_depth = 1024;
+// up to this many digits always fit into a qint64
+static constexpr std::size_t s_max_exact_digits = 18;
+
+static bool isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+Reader::Reader(const QByteArray& data, QString what)
+    : m_begin(data.constData()), m_pos(data.constData()), m_end(data.constData() + data.size()), m_what(std::move(what))
+{}
+
+void Reader::fail(const QString& message) const
+{
+    throw JsonException(QString("%1: %2 at offset %3").arg(m_what, message).arg(static_cast<qint64>(m_pos - m_begin)));
+}
+
+char Reader::next()
+{
+    while (m_pos != m_end && (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t'))
+        ++m_pos;
+    if (m_pos == m_end)
+        fail("Unexpected end of data");
+    return *m_pos;
+}
+
+void Reader::expect(char c)
+{
+    if (next() != c)
+        fail(QString("Expected '%1'").arg(c));
+    ++m_pos;
+}
+
+void Reader::expectWord(const char* word)
+{
+    auto length = std::strlen(word);
+    if (static_cast<std::size_t>(m_end - m_pos) < length || std::memcmp(m_pos, word, length) != 0)
+        fail(QString("Expected '%1'").arg(word));
+    m_pos += length;
+}
+
+Reader::Type Reader::peek()
+{
+    switch (next()) {
+        case '{':
+            return Type::Object;
+        case '[':
+            return Type::Array;
+        case '"':
+            return Type::String;
+        case 't':
+        case 'f':
+            return Type::Bool;
+        case 'n':
+            return Type::Null;
+        default:
+            if (*m_pos == '-' || isDigit(*m_pos))
+                return Type::Number;
+            fail("Expected a value");
+    }
+}
+
+void Reader::push(bool object)
+{
+    if (m_levels.size() >= s_max_depth)
+        fail("Too deeply nested");
+    m_levels.push_back({ object, false });
+}
+
+void Reader::beginObject()
+{
+    if (peek() != Type::Object)
+        fail("Expected an object");
+    ++m_pos;
+    push(true);
+}
+
+void Reader::beginArray()
+{
+    if (peek() != Type::Array)
+        fail("Expected an array");
+    ++m_pos;
+    push(false);
+}
+
+bool Reader::nextInContainer(bool object)
+{
+    if (m_levels.empty() || m_levels.back().object != object)
+        fail(object ? "Not inside an object" : "Not inside an array");
+
+    auto& level = m_levels.back();
+    char c = next();
+    if (c == (object ? '}' : ']')) {
+        ++m_pos;
+        m_levels.pop_back();
+        return false;
+    }
+    if (level.hasEntries) {
+        if (c != ',')
+            fail(object ? "Expected ',' or '}'" : "Expected ',' or ']'");
+        ++m_pos;
+    }
+    level.hasEntries = true;
+    return true;
+}
+
+bool Reader::nextKey(std::string_view& key)
+{
+    if (!nextInContainer(true))
+        return false;
+    if (next() != '"')
+        fail("Expected a key");
+    key = parseString(m_keyBuffer);
+    expect(':');
+    return true;
+}
+
+bool Reader::nextElement()
+{
+    return nextInContainer(false);
+}
+
+static int hexValue(char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+    return -1;
+}
+
+void Reader::appendUnicodeEscape(std::string& buffer)
+{
+    auto readHex = [this]() {
+        if (m_end - m_pos < 4)
+            fail("Invalid unicode escape");
+        char32_t value = 0;
+        for (int i = 0; i < 4; ++i) {
+            int digit = hexValue(m_pos[i]);
+            if (digit < 0)
+                fail("Invalid unicode escape");
+            value = value * 16 + digit;
+        }
+        m_pos += 4;
+        return value;
+    };
+
+    // m_pos is right after the "\u"
+    char32_t code = readHex();
+    if (code >= 0xD800 && code <= 0xDBFF) {
+        if (m_end - m_pos >= 6 && m_pos[0] == '\\' && m_pos[1] == 'u') {
+            m_pos += 2;
+            char32_t low = readHex();
+            if (low >= 0xDC00 && low <= 0xDFFF)
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            else
+                code = 0xFFFD;
+        } else {
+            code = 0xFFFD;
+        }
+    } else if (code >= 0xDC00 && code <= 0xDFFF) {
+        code = 0xFFFD;
+    }
+
+    if (code < 0x80) {
+        buffer += static_cast<char>(code);
+    } else if (code < 0x800) {
+        buffer += static_cast<char>(0xC0 | (code >> 6));
+        buffer += static_cast<char>(0x80 | (code & 0x3F));
+    } else if (code < 0x10000) {
+        buffer += static_cast<char>(0xE0 | (code >> 12));
+        buffer += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        buffer += static_cast<char>(0x80 | (code & 0x3F));
+    } else {
+        buffer += static_cast<char>(0xF0 | (code >> 18));
+        buffer += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+        buffer += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+        buffer += static_cast<char>(0x80 | (code & 0x3F));
+    }
+}
+
+std::string_view Reader::parseString(std::string& buffer)
+{
+    // m_pos is on the opening quote
+    const char* start = ++m_pos;
+    while (m_pos != m_end && *m_pos != '"' && *m_pos != '\\' && static_cast<unsigned char>(*m_pos) >= 0x20)
+        ++m_pos;
+    if (m_pos == m_end)
+        fail("Unterminated string");
+    if (*m_pos == '"') {
+        // nothing to decode, which is most strings
+        return { start, static_cast<std::size_t>(m_pos++ - start) };
+    }
+
+    buffer.assign(start, m_pos);
+    while (true) {
+        if (m_pos == m_end)
+            fail("Unterminated string");
+        char c = *m_pos;
+        if (c == '"') {
+            ++m_pos;
+            return buffer;
+        }
+        if (static_cast<unsigned char>(c) < 0x20)
+            fail("Control character in string");
+        ++m_pos;
+        if (c != '\\') {
+            buffer += c;
+            continue;
+        }
+
+        if (m_pos == m_end)
+            fail("Unterminated string");
+        switch (*m_pos++) {
+            case '"':
+                buffer += '"';
+                break;
+            case '\\':
+                buffer += '\\';
+                break;
+            case '/':
+                buffer += '/';
+                break;
+            case 'b':
+                buffer += '\b';
+                break;
+            case 'f':
+                buffer += '\f';
+                break;
+            case 'n':
+                buffer += '\n';
+                break;
+            case 'r':
+                buffer += '\r';
+                break;
+            case 't':
+                buffer += '\t';
+                break;
+            case 'u':
+                appendUnicodeEscape(buffer);
+                break;
+            default:
+                --m_pos;
+                fail("Invalid escape sequence");
+        }
+    }
+}
+
+std::string_view Reader::parseNumber(bool& integral)
+{
+    const char* start = m_pos;
+    integral = true;
+
+    if (*m_pos == '-')
+        ++m_pos;
+    if (m_pos == m_end || !isDigit(*m_pos))
+        fail("Invalid number");
+    if (*m_pos == '0') {
+        ++m_pos;
+    } else {
+        while (m_pos != m_end && isDigit(*m_pos))
+            ++m_pos;
+    }
+
+    if (m_pos != m_end && *m_pos == '.') {
+        integral = false;
+        ++m_pos;
+        if (m_pos == m_end || !isDigit(*m_pos))
+            fail("Invalid number");
+        while (m_pos != m_end && isDigit(*m_pos))
+            ++m_pos;
+    }
+    if (m_pos != m_end && (*m_pos == 'e' || *m_pos == 'E')) {
+        integral = false;
+        ++m_pos;
+        if (m_pos != m_end && (*m_pos == '+' || *m_pos == '-'))
+            ++m_pos;
+        if (m_pos == m_end || !isDigit(*m_pos))
+            fail("Invalid number");
+        while (m_pos != m_end && isDigit(*m_pos))
+            ++m_pos;
+    }
+
+    return { start, static_cast<std::size_t>(m_pos - start) };
+}
+
+QString Reader::readString()
+{
+    if (peek() != Type::String)
+        fail("Expected a string");
+    auto value = parseString(m_valueBuffer);
+    return QString::fromUtf8(value.data(), static_cast<int>(value.size()));
+}
+
+double Reader::readDouble()
+{
+    if (peek() != Type::Number)
+        fail("Expected a number");
+    bool integral;
+    auto text = parseNumber(integral);
+    bool ok;
+    double value = QByteArray::fromRawData(text.data(), static_cast<int>(text.size())).toDouble(&ok);
+    if (!ok)
+        fail("Invalid number");
+    return value;
+}
+
+qint64 Reader::readInteger()
+{
+    if (peek() != Type::Number)
+        fail("Expected a number");
+    const char* start = m_pos;
+    bool integral;
+    auto text = parseNumber(integral);
+
+    bool negative = text.front() == '-';
+    if (integral && text.size() - negative <= s_max_exact_digits) {
+        qint64 value = 0;
+        for (auto c : text.substr(negative))
+            value = value * 10 + (c - '0');
+        return negative ? -value : value;
+    }
+
+    m_pos = start;
+    double value = std::trunc(readDouble());
+    if (!(value >= -9.2e18 && value <= 9.2e18))
+        fail("Number out of range");
+    return static_cast<qint64>(value);
+}
+
+bool Reader::readBool()
+{
+    if (peek() != Type::Bool)
+        fail("Expected a boolean");
+    bool value = *m_pos == 't';
+    expectWord(value ? "true" : "false");
+    return value;
+}
+
+bool Reader::readNull()
+{
+    if (next() != 'n')
+        return false;
+    expectWord("null");
+    return true;
+}
+
+void Reader::skip()
+{
+    std::string_view key;
+    switch (peek()) {
+        case Type::Object:
+            beginObject();
+            while (nextKey(key))
+                skip();
+            break;
+        case Type::Array:
+            beginArray();
+            while (nextElement())
+                skip();
+            break;
+        case Type::String:
+            parseString(m_valueBuffer);
+            break;
+        case Type::Number: {
+            bool integral;
+            parseNumber(integral);
+            break;
+        }
+        case Type::Bool:
+            readBool();
+            break;
+        case Type::Null:
+            readNull();
+            break;
+    }
+}
+
+QJsonValue Reader::readValue()
+{
+    switch (peek()) {
+        case Type::Object: {
+            QJsonObject object;
+            std::string_view key;
+            beginObject();
+            while (nextKey(key)) {
+                // the key has to be copied before reading the value, which might have keys of its own
+                auto name = QString::fromUtf8(key.data(), static_cast<int>(key.size()));
+                object.insert(name, readValue());
+            }
+            return object;
+        }
+        case Type::Array: {
+            QJsonArray array;
+            beginArray();
+            while (nextElement())
+                array.append(readValue());
+            return array;
+        }
+        case Type::String:
+            return readString();
+        case Type::Number: {
+            const char* start = m_pos;
+            bool integral;
+            auto text = parseNumber(integral);
+            m_pos = start;
+            if (integral && text.size() - (text.front() == '-') <= s_max_exact_digits)
+                return readInteger();
+            return readDouble();
+        }
+        case Type::Bool:
+            return readBool();
+        case Type::Null:
+            readNull();
+            return QJsonValue::Null;
+    }
+    return {};
+}
+
+void Reader::end()
+{
+    if (!m_levels.empty())
+        fail("Unexpected end of document");
+    while (m_pos != m_end && (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t'))
+        ++m_pos;
+    if (m_pos != m_end)
+        fail("Garbage after the document");
+}
+}  // namespace Json
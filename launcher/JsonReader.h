@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QJsonValue>
+#include <QString>
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Json.h"
+
+namespace Json {
+/** A forward-only reader over a JSON document, for large documents with a known shape.
+ *
+ *  Unlike QJsonDocument it doesn't build a tree of the whole document: values are handed out as the reader gets to
+ *  them, object keys are only views into the data, and whatever the caller isn't interested in gets skipped without
+ *  allocating anything. Parts that are easier to handle with the usual helpers can still be read into a QJsonValue
+ *  with readValue().
+ *
+ *  Objects are read like this:
+ *
+ *      reader.beginObject();
+ *      std::string_view key;
+ *      while (reader.nextKey(key)) {
+ *          if (key == "name")
+ *              name = reader.readString();
+ *          else
+ *              reader.skip();
+ *      }
+ *
+ *  Arrays the same way, with beginArray() and nextElement(). Every value has to be read or skipped.
+ *  Anything that isn't valid JSON, or isn't what the caller asked for, throws a JsonException.
+ *
+ *  This only pays off when the caller turns the document into its own structures, like asset indexes and meta version
+ *  lists do. Code that wants a QJsonObject in the end, like requireDocument() and everything built on it, is better
+ *  off with QJsonDocument, which builds its tree faster than readValue() can.
+ */
+class Reader {
+   public:
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    /** 'data' has to outlive the reader. */
+    explicit Reader(const QByteArray& data, QString what = "Document");
+
+    /** The type of the next value, without reading it. @throw JsonException */
+    Type peek();
+
+    /// @throw JsonException
+    void beginObject();
+    /** Moves to the next key of the current object, or returns false at its end.
+     *  'key' stays valid until the next key is read. @throw JsonException */
+    bool nextKey(std::string_view& key);
+
+    /// @throw JsonException
+    void beginArray();
+    /** Moves to the next element of the current array, or returns false at its end. @throw JsonException */
+    bool nextElement();
+
+    /// @throw JsonException
+    QString readString();
+    /// @throw JsonException
+    double readDouble();
+    /** Numbers with a fraction or an exponent are truncated. @throw JsonException */
+    qint64 readInteger();
+    /// @throw JsonException
+    bool readBool();
+    /** Reads a null if that's what comes next. @throw JsonException */
+    bool readNull();
+    /** Reads the next value, whatever it is, the same way QJsonDocument would have. @throw JsonException */
+    QJsonValue readValue();
+    /// @throw JsonException
+    void skip();
+
+    /** Makes sure nothing but whitespace follows the document. @throw JsonException */
+    void end();
+
+   private:
+    [[noreturn]] void fail(const QString& message) const;
+    char next();
+    void expect(char c);
+    void expectWord(const char* word);
+    void push(bool object);
+    bool nextInContainer(bool object);
+    std::string_view parseString(std::string& buffer);
+    std::string_view parseNumber(bool& integral);
+    void appendUnicodeEscape(std::string& buffer);
+
+    const char* m_begin;
+    const char* m_pos;
+    const char* m_end;
+    QString m_what;
+    // One entry for each open container: whether it's an object, and whether it has had any entries yet
+    struct Level {
+        bool object;
+        bool hasEntries;
+    };
+    std::vector<Level> m_levels;
+    // Strings with escapes in them get decoded into these, keys separately so they survive reading their value
+    std::string m_keyBuffer;
+    std::string m_valueBuffer;
+};
+}  // namespace Json
@@ -5,51 +5,85 @@
 #include <QRegularExpressionMatch>
 #include <QUrl>
 
+#include <algorithm>
+
 Version::Version(QString str) : m_string(std::move(str))
 {
     parse();
 }
 
-#define VERSION_OPERATOR(return_on_different)                                               \
-    bool exclude_our_sections = false;                                                      \
-    bool exclude_their_sections = false;                                                    \
-                                                                                            \
-    const auto size = qMax(m_sections.size(), other.m_sections.size());                     \
-    for (int i = 0; i < size; ++i) {                                                        \
-        Section sec1 = (i >= m_sections.size()) ? Section() : m_sections.at(i);             \
-        Section sec2 = (i >= other.m_sections.size()) ? Section() : other.m_sections.at(i); \
-                                                                                            \
-        { /* Don't include appendixes in the comparison */                                  \
-            if (sec1.isAppendix())                                                          \
-                exclude_our_sections = true;                                                \
-            if (sec2.isAppendix())                                                          \
-                exclude_their_sections = true;                                              \
-                                                                                            \
-            if (exclude_our_sections) {                                                     \
-                sec1 = Section();                                                           \
-                if (sec2.m_isNull)                                                          \
-                    break;                                                                  \
-            }                                                                               \
-                                                                                            \
-            if (exclude_their_sections) {                                                   \
-                sec2 = Section();                                                           \
-                if (sec1.m_isNull)                                                          \
-                    break;                                                                  \
-            }                                                                               \
-        }                                                                                   \
-                                                                                            \
-        if (sec1 != sec2)                                                                   \
-            return return_on_different;                                                     \
+namespace {
+// Ordered like the sections they stand for, including how those compare to a section a shorter version doesn't have
+enum KeyByte : char {
+    Zero = 0x00,
+    End = 0x01,
+    Number = 0x02,
+    String = 0x03,
+};
+}  // namespace
+
+#define VERSION_OPERATOR(return_on_different)                                                     \
+    static const Section s_null;                                                                  \
+    bool exclude_our_sections = false;                                                            \
+    bool exclude_their_sections = false;                                                          \
+                                                                                                  \
+    const auto size = qMax(m_sections.size(), other.m_sections.size());                           \
+    for (int i = 0; i < size; ++i) {                                                              \
+        const Section* sec1 = (i >= m_sections.size()) ? &s_null : &m_sections.at(i);             \
+        const Section* sec2 = (i >= other.m_sections.size()) ? &s_null : &other.m_sections.at(i); \
+                                                                                                  \
+        { /* Don't include appendixes in the comparison */                                        \
+            if (sec1->isAppendix())                                                               \
+                exclude_our_sections = true;                                                      \
+            if (sec2->isAppendix())                                                               \
+                exclude_their_sections = true;                                                    \
+                                                                                                  \
+            if (exclude_our_sections) {                                                           \
+                sec1 = &s_null;                                                                   \
+                if (sec2->m_isNull)                                                               \
+                    break;                                                                        \
+            }                                                                                     \
+                                                                                                  \
+            if (exclude_their_sections) {                                                         \
+                sec2 = &s_null;                                                                   \
+                if (sec1->m_isNull)                                                               \
+                    break;                                                                        \
+            }                                                                                     \
+        }                                                                                         \
+                                                                                                  \
+        if (*sec1 != *sec2)                                                                       \
+            return return_on_different;                                                           \
     }
 
-bool Version::operator<(const Version& other) const
+bool Version::sectionsLessThan(const Version& other) const
 {
-    VERSION_OPERATOR(sec1 < sec2)
+    VERSION_OPERATOR(*sec1 < *sec2)
 
     return false;
 }
+
+bool Version::operator<(const Version& other) const
+{
+    if (!m_key.isEmpty() && !other.m_key.isEmpty()) {
+        auto [ours, theirs] = std::mismatch(m_key.cbegin(), m_key.cend(), other.m_key.cbegin(), other.m_key.cend());
+        if (ours == m_key.cend() || theirs == other.m_key.cend())
+            return false;
+
+        // A number against a string is the one case where sections don't have an order: whichever comes first is less,
+        // so leave that to the sections. These bytes can also be part of a number or string, which just takes longer.
+        auto a = static_cast<uchar>(*ours);
+        auto b = static_cast<uchar>(*theirs);
+        if (!((a == Number && b == String) || (a == String && b == Number)))
+            return a < b;
+    }
+
+    return sectionsLessThan(other);
+}
 bool Version::operator==(const Version& other) const
 {
+    if (!m_key.isEmpty() && !other.m_key.isEmpty())
+        return m_key == other.m_key;
+
     VERSION_OPERATOR(false)
 
     return true;
@@ -106,6 +140,47 @@ void Version::parse()
 
     if (!currentSection.isEmpty())
         m_sections.append(Section(currentSection));
+
+    buildKey();
+}
+
+void Version::buildKey()
+{
+    m_key.clear();
+    m_key.reserve(m_sections.size() * 5 + 1);
+
+    for (const auto& section : m_sections) {
+        // Nothing from the appendix on takes part in comparisons
+        if (section.isAppendix())
+            break;
+
+        if (section.m_stringPart.isEmpty()) {
+            if (section.m_numPart == 0) {
+                m_key.append(Zero);
+                continue;
+            }
+            m_key.append(Number);
+            for (int shift = 24; shift >= 0; shift -= 8)
+                m_key.append(static_cast<char>((static_cast<quint32>(section.m_numPart) >> shift) & 0xff));
+            continue;
+        }
+
+        // Pre-releases sort before a missing section while other strings sort after it, so they can't share a type byte
+        if (section.isPreRelease() || section.m_stringPart.contains(QChar(0))) {
+            m_key.clear();
+            return;
+        }
+
+        m_key.append(String);
+        for (auto c : section.m_stringPart) {
+            m_key.append(static_cast<char>(c.unicode() >> 8));
+            m_key.append(static_cast<char>(c.unicode() & 0xff));
+        }
+        m_key.append('\0');
+        m_key.append('\0');
+    }
+
+    m_key.append(End);
 }
 
 /// qDebug print support for the Version class
@@ -159,5 +159,13 @@ class Version {
     QString m_string;
     QList<Section> m_sections;
 
+    /** The sections up to the first appendix, encoded so that comparing keys bytewise orders them like the sections.
+     *  Each section becomes a type byte, followed by the number (big-endian) or the string (UTF-16BE, 0-terminated),
+     *  and the key ends in a byte that sorts like the missing sections of a shorter version.
+     *  Empty if the version has sections whose order can't be expressed this way, like pre-release tags. */
+    QByteArray m_key;
+
     void parse();
+    void buildKey();
+    bool sectionsLessThan(const Version& other) const;
 };
@@ -39,16 +39,37 @@
 #include <QDebug>
 #include <QEventLoop>
 #include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QImageReader>
 #include <QMap>
 #include <QMimeData>
+#include <QPixmap>
 #include <QSet>
 #include <QUrl>
+#include <QtConcurrent>
 #include "icons/IconUtils.h"
 
 #define MAX_SIZE 1024
 
+// Instance icons are painted at 48px, so this leaves room for high DPI screens and the icon picker
+static constexpr int s_decoded_size = 128;
+
+// Enough for several hundred icons at the size above
+static constexpr int s_decoded_cache_kib = 32 * 1024;
+
+static QImage decodeIcon(const QString& path)
+{
+    QImageReader reader(path);
+    auto size = reader.size();
+    if (size.isValid() && (size.width() > s_decoded_size || size.height() > s_decoded_size))
+        reader.setScaledSize(size.scaled(s_decoded_size, s_decoded_size, Qt::KeepAspectRatio));
+    return reader.read();
+}
+
 IconList::IconList(const QStringList& builtinPaths, QString path, QObject* parent) : QAbstractListModel(parent)
 {
+    m_decoded.setMaxCost(s_decoded_cache_kib);
+
     QSet<QString> builtinNames;
 
     // add builtin icons
@@ -133,6 +154,7 @@ void IconList::directoryChanged(const QString& path)
         if (!IconUtils::isIconSuffix(suffix))
             key = rmfile.fileName();
 
+        forgetDecoded(remove);
         int idx = getIconIndex(key);
         if (idx == -1)
             continue;
@@ -179,11 +201,11 @@ void IconList::fileChanged(const QString& path)
     int idx = getIconIndex(key);
     if (idx == -1)
         return;
-    QIcon icon(path);
-    if (!icon.availableSizes().size())
+    if (!QImageReader(path).canRead())
         return;
 
-    icons[idx].m_images[IconType::FileBased].icon = icon;
+    // Decoded again next time it's shown
+    forgetDecoded(path);
     dataChanged(index(idx), index(idx));
     emit iconUpdated(key);
 }
@@ -272,7 +294,7 @@ QVariant IconList::data(const QModelIndex& index, int role) const
 
     switch (role) {
         case Qt::DecorationRole:
-            return icons[row].icon();
+            return iconAt(row);
         case Qt::DisplayRole:
             return icons[row].name();
         case Qt::UserRole:
@@ -356,13 +378,14 @@ bool IconList::addThemeIcon(const QString& key)
 bool IconList::addIcon(const QString& key, const QString& name, const QString& path, const IconType type)
 {
     // replace the icon even? is the input valid?
-    QIcon icon(path);
-    if (icon.isNull())
+    // Only the header is looked at here, the image itself gets decoded when it's first shown
+    if (!QImageReader(path).canRead())
         return false;
+    forgetDecoded(path);
     auto iter = name_index.find(key);
     if (iter != name_index.end()) {
         auto& oldOne = icons[*iter];
-        oldOne.replace(type, icon, path);
+        oldOne.replace(type, QIcon(), path);
         dataChanged(index(*iter), index(*iter));
         return true;
     }
@@ -372,7 +395,7 @@ bool IconList::addIcon(const QString& key, const QString& name, const QString& p
         MMCIcon mmc_icon;
         mmc_icon.m_name = name;
         mmc_icon.m_key = key;
-        mmc_icon.replace(type, icon, path);
+        mmc_icon.replace(type, QIcon(), path);
         icons.push_back(mmc_icon);
         name_index[key] = icons.size() - 1;
     }
@@ -382,8 +405,13 @@ bool IconList::addIcon(const QString& key, const QString& name, const QString& p
 
 void IconList::saveIcon(const QString& key, const QString& path, const char* format) const
 {
-    auto icon = getIcon(key);
-    auto pixmap = icon.pixmap(128, 128);
+    // This can't wait for the background decoding, so take the icon straight from its file
+    auto entry = icon(key);
+    if (!entry)
+        entry = icon("grass");
+    if (!entry)
+        return;
+    auto pixmap = entry->icon().pixmap(128, 128);
     pixmap.save(path, format);
 }
 
@@ -398,20 +426,97 @@ void IconList::reindex()
 }
 
 QIcon IconList::getIcon(const QString& key) const
+{
+    return lookupIcon(key, true);
+}
+
+QIcon IconList::getIconAsync(const QString& key) const
+{
+    auto icon = lookupIcon(key, false);
+    if (icon.isNull())
+        icon = lookupIcon("grass", false);
+    return icon;
+}
+
+QIcon IconList::lookupIcon(const QString& key, bool loadOnMiss) const
 {
     int icon_index = getIconIndex(key);
 
-    if (icon_index != -1)
-        return icons[icon_index].icon();
+    if (icon_index != -1 && !m_undecodable.contains(icons[icon_index].getFilePath()))
+        return iconAt(icon_index, loadOnMiss);
 
     // Fallback for icons that don't exist.
     icon_index = getIconIndex("grass");
 
     if (icon_index != -1)
-        return icons[icon_index].icon();
+        return iconAt(icon_index, loadOnMiss);
     return QIcon();
 }
 
+QIcon IconList::iconAt(int row, bool loadOnMiss) const
+{
+    auto& entry = icons[row];
+    if (entry.type() != IconType::FileBased)
+        return entry.icon();
+
+    auto path = entry.getFilePath();
+    if (auto decoded = m_decoded.object(path))
+        return *decoded;
+
+    requestDecode(path);
+    // Views get told when the decoded icon is ready, but callers that only ask once need something that draws now,
+    // so they get an icon that reads the file itself when it is first painted
+    return loadOnMiss ? QIcon(path) : QIcon();
+}
+
+void IconList::requestDecode(const QString& path) const
+{
+    if (m_decoding.contains(path) || m_undecodable.contains(path))
+        return;
+
+    auto generation = ++m_decode_generation;
+    m_decoding.insert(path, generation);
+
+    auto self = const_cast<IconList*>(this);
+    auto watcher = new QFutureWatcher<QImage>(self);
+    connect(watcher, &QFutureWatcher<QImage>::finished, self, [self, watcher, path, generation] {
+        self->iconDecoded(path, generation, watcher->result());
+        watcher->deleteLater();
+    });
+    watcher->setFuture(QtConcurrent::run(decodeIcon, path));
+}
+
+void IconList::iconDecoded(const QString& path, int generation, const QImage& image)
+{
+    if (m_decoding.value(path) != generation)
+        return;
+    m_decoding.remove(path);
+
+    if (image.isNull()) {
+        qWarning() << "Could not decode icon" << path;
+        m_undecodable.insert(path);
+    } else {
+        // QPixmaps can only be made on the GUI thread, so this is the part that can't be done in the background
+        auto cost = qMax(1, static_cast<int>(image.sizeInBytes() / 1024));
+        m_decoded.insert(path, new QIcon(QPixmap::fromImage(image)), cost);
+    }
+
+    for (int i = 0; i < icons.size(); i++) {
+        if (icons[i].type() == IconType::FileBased && icons[i].getFilePath() == path) {
+            dataChanged(index(i), index(i));
+            emit iconUpdated(icons[i].m_key);
+            break;
+        }
+    }
+}
+
+void IconList::forgetDecoded(const QString& path)
+{
+    m_decoded.remove(path);
+    m_decoding.remove(path);
+    m_undecodable.remove(path);
+}
+
 int IconList::getIconIndex(const QString& key) const
 {
     auto iter = name_index.find(key == "default" ? "grass" : key);
@@ -35,9 +35,12 @@
 #pragma once
 
 #include <QAbstractListModel>
+#include <QCache>
 #include <QDir>
 #include <QFile>
+#include <QHash>
 #include <QMutex>
+#include <QSet>
 #include <QtGui/QIcon>
 #include <memory>
 
@@ -54,7 +57,13 @@ class IconList : public QAbstractListModel {
     explicit IconList(const QStringList& builtinPaths, QString path, QObject* parent = 0);
     virtual ~IconList() {};
 
+    /** Returns the icon to show for 'key'. Icons from the icons folder are decoded in the background the first time
+     *  they are asked for. Until then this returns an icon that reads the file itself when painted, for callers that
+     *  only ask once. */
     QIcon getIcon(const QString& key) const;
+    /** Like getIcon(), but returns the default icon while the real one is being decoded, so it never decodes on the
+     *  calling thread. For views that get asked on every paint; iconUpdated() tells when to ask again. */
+    QIcon getIconAsync(const QString& key) const;
     int getIconIndex(const QString& key) const;
     QString getDirectory() const;
 
@@ -91,6 +100,11 @@ class IconList : public QAbstractListModel {
     IconList& operator=(const IconList&) = delete;
     void reindex();
     void sortIconList();
+    QIcon lookupIcon(const QString& key, bool loadOnMiss) const;
+    QIcon iconAt(int row, bool loadOnMiss = false) const;
+    void requestDecode(const QString& path) const;
+    void iconDecoded(const QString& path, int generation, const QImage& image);
+    void forgetDecoded(const QString& path);
 
    public slots:
     void directoryChanged(const QString& path);
@@ -105,4 +119,11 @@ class IconList : public QAbstractListModel {
     QMap<QString, int> name_index;
     QVector<MMCIcon> icons;
     QDir m_dir;
+
+    // Decoded file based icons by path, bounded by their size in KiB
+    mutable QCache<QString, QIcon> m_decoded;
+    // Paths being decoded, and the generation of the request, so results for a file that changed since are dropped
+    mutable QHash<QString, int> m_decoding;
+    mutable int m_decode_generation = 0;
+    QSet<QString> m_undecodable;
 };
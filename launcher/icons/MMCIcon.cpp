@@ -81,6 +81,9 @@ QIcon MMCIcon::icon() const
     auto& icon = m_images[m_current_type].icon;
     if (!icon.isNull())
         return icon;
+    // Not decoded yet, so load it at full size. IconList::getIcon is the cheaper way to get one for display.
+    if (!m_images[m_current_type].filename.isEmpty())
+        return QIcon(m_images[m_current_type].filename);
     // FIXME: inject this.
     return QIcon::fromTheme(m_images[m_current_type].key);
 }
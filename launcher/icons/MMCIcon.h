@@ -43,7 +43,8 @@ struct MMCImage {
     QIcon icon;
     QString key;
     QString filename;
-    bool present() const { return !icon.isNull() || !key.isEmpty(); }
+    // File based images keep only their file name, IconList decodes them when they are first shown
+    bool present() const { return !icon.isNull() || !key.isEmpty() || !filename.isEmpty(); }
 };
 
 struct MMCIcon {
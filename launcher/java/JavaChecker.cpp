@@ -42,14 +42,36 @@
 
 #include "Commandline.h"
 #include "FileSystem.h"
+#include "java/JavaProbe.h"
 #include "java/JavaUtils.h"
 
 JavaChecker::JavaChecker(QString path, QString args, int minMem, int maxMem, int permGen, int id)
     : Task(), m_path(path), m_args(args), m_minMem(minMem), m_maxMem(maxMem), m_permGen(permGen), m_id(id)
 {}
 
+bool JavaChecker::isPlainProbe() const
+{
+    return m_args.isEmpty() && m_minMem == 0 && m_maxMem == 0 && (m_permGen == 0 || m_permGen == 64);
+}
+
 void JavaChecker::executeTask()
 {
+    // Checks with custom arguments are meant to find out whether the JVM starts with them, so those always run it
+    if (isPlainProbe()) {
+        auto probed = JavaProbe::Cache::instance().find(m_path);
+        if (!probed)
+            probed = JavaProbe::probeWithoutJvm(m_path);
+
+        if (probed) {
+            qDebug() << "Java checker found" << m_path << "without starting it:" << probed->javaVersion.toString() << probed->realPlatform
+                     << probed->javaVendor;
+            probed->id = m_id;
+            emit checkFinished(*probed);
+            emitSucceeded();
+            return;
+        }
+    }
+
     QString checkerJar = JavaUtils::getJavaCheckPath();
 
     if (checkerJar.isEmpty()) {
@@ -180,6 +202,8 @@ void JavaChecker::finished(int exitcode, QProcess::ExitStatus status)
     result.javaVersion = java_version;
     result.javaVendor = java_vendor;
     qDebug() << "Java checker succeeded.";
+    if (isPlainProbe())
+        JavaProbe::Cache::instance().insert(result);
     emit checkFinished(result);
     emitSucceeded();
 }
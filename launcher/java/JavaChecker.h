@@ -33,6 +33,10 @@ class JavaChecker : public Task {
    protected:
     virtual void executeTask() override;
 
+   private:
+    /** Whether this only asks about the JVM itself, without any argument that could change the outcome. */
+    bool isPlainProbe() const;
+
    private:
     QProcessPtr process;
     QTimer killTimer;
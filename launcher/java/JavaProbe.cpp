@@ -0,0 +1,282 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "JavaProbe.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QtEndian>
+
+#include "Application.h"
+#include "FileSystem.h"
+#include "Json.h"
+
+namespace JavaProbe {
+
+QString normalizeArch(const QString& arch)
+{
+    auto lower = arch.trimmed().toLower();
+    if (lower == "amd64" || lower == "x86_64" || lower == "x64")
+        return "x86_64";
+    if (lower == "x86" || lower == "i386" || lower == "i486" || lower == "i586" || lower == "i686")
+        return "x86";
+    if (lower == "aarch64" || lower == "arm64")
+        return "arm64";
+    if (lower == "arm" || lower == "armhf" || lower == "aarch32" || lower == "arm32")
+        return "arm32";
+    return lower;
+}
+
+bool is64BitArch(const QString& arch)
+{
+    auto normalized = normalizeArch(arch);
+    // ppc64le, mips64el, riscv64, loongarch64... and the two that don't say so
+    return normalized.contains("64") || normalized == "s390x" || normalized == "sparcv9";
+}
+
+QString binaryArchitecture(const QString& path)
+{
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+
+    auto header = file.read(64);
+    if (header.size() < 20)
+        return {};
+    auto data = reinterpret_cast<const uchar*>(header.constData());
+
+    // ELF
+    if (header.startsWith("\x7f" "ELF")) {
+        bool is_64 = data[4] == 2;
+        bool big_endian = data[5] == 2;
+        auto machine = big_endian ? qFromBigEndian<quint16>(data + 18) : qFromLittleEndian<quint16>(data + 18);
+        switch (machine) {
+            case 3:  // EM_386
+                return "i386";
+            case 40:  // EM_ARM
+                return "arm";
+            case 62:  // EM_X86_64
+                return "amd64";
+            case 183:  // EM_AARCH64
+                return "aarch64";
+            case 21:  // EM_PPC64
+                return big_endian ? "ppc64" : "ppc64le";
+            case 243:  // EM_RISCV
+                return is_64 ? "riscv64" : "riscv32";
+            default:
+                return {};
+        }
+    }
+
+    // PE, behind the DOS stub
+    if (header.startsWith("MZ")) {
+        auto pe_offset = qFromLittleEndian<quint32>(data + 0x3c);
+        if (!file.seek(pe_offset))
+            return {};
+        auto pe_header = file.read(6);
+        if (pe_header.size() < 6 || !pe_header.startsWith(QByteArray("PE\0\0", 4)))
+            return {};
+        switch (qFromLittleEndian<quint16>(reinterpret_cast<const uchar*>(pe_header.constData()) + 4)) {
+            case 0x014c:  // IMAGE_FILE_MACHINE_I386
+                return "x86";
+            case 0x8664:  // IMAGE_FILE_MACHINE_AMD64
+                return "amd64";
+            case 0xaa64:  // IMAGE_FILE_MACHINE_ARM64
+                return "aarch64";
+            default:
+                return {};
+        }
+    }
+
+    // Mach-O. Universal binaries don't tell which slice runs, so we leave those to the JVM.
+    if (qFromLittleEndian<quint32>(data) == 0xfeedfacf) {
+        switch (qFromLittleEndian<quint32>(data + 4)) {
+            case 0x01000007:  // CPU_TYPE_X86_64
+                return "x86_64";
+            case 0x0100000c:  // CPU_TYPE_ARM64
+                return "aarch64";
+            default:
+                return {};
+        }
+    }
+
+    return {};
+}
+
+QMap<QString, QString> readReleaseFile(const QString& java_home)
+{
+    QFile file(FS::PathCombine(java_home, "release"));
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text))
+        return {};
+
+    QMap<QString, QString> values;
+    while (!file.atEnd()) {
+        auto line = QString::fromUtf8(file.readLine()).trimmed();
+        auto separator = line.indexOf('=');
+        if (separator <= 0)
+            continue;
+
+        auto value = line.mid(separator + 1).trimmed();
+        if (value.size() >= 2 && value.startsWith('"') && value.endsWith('"'))
+            value = value.mid(1, value.size() - 2);
+        values.insert(line.left(separator).trimmed(), value);
+    }
+
+    return values;
+}
+
+std::optional<JavaChecker::Result> probeWithoutJvm(const QString& path)
+{
+    QFileInfo binary(QFileInfo(path).canonicalFilePath());
+    if (!binary.exists())
+        return {};
+
+    // <home>/bin/java, or <home>/jre/bin/java on Java 8 JDKs
+    QDir home = binary.dir();
+    if (!home.cdUp())
+        return {};
+    auto release = readReleaseFile(home.absolutePath());
+    if (release.isEmpty() && home.dirName() == "jre" && home.cdUp())
+        release = readReleaseFile(home.absolutePath());
+
+    auto version = release.value("JAVA_VERSION");
+    auto vendor = release.value("IMPLEMENTOR");
+    auto release_arch = release.value("OS_ARCH");
+    if (version.isEmpty() || vendor.isEmpty() || release_arch.isEmpty())
+        return {};
+
+    // The release file could have been copied around, so only trust it if the binary agrees with it
+    auto arch = binaryArchitecture(binary.absoluteFilePath());
+    if (arch.isEmpty() || normalizeArch(arch) != normalizeArch(release_arch))
+        return {};
+
+    JavaChecker::Result result;
+    result.path = path;
+    result.validity = JavaChecker::Result::Validity::Valid;
+    result.javaVersion = version;
+    result.javaVendor = vendor;
+    result.realPlatform = arch;
+    result.is_64bit = is64BitArch(arch);
+    result.mojangPlatform = result.is_64bit ? "64" : "32";
+    return result;
+}
+
+Cache& Cache::instance()
+{
+    static Cache s_instance;
+    return s_instance;
+}
+
+Cache::Cache()
+{
+    if (!APPLICATION_DYN)  // in tests the application macro doesn't work, so keep it in memory only
+        return;
+
+    m_file_path = FS::PathCombine(APPLICATION->dataRoot(), "cache", "java_probes.json");
+    if (!QFileInfo::exists(m_file_path))
+        return;
+
+    try {
+        auto root = Json::requireObject(Json::requireDocument(m_file_path, "Java probe cache"));
+        for (auto value : Json::ensureArray(root, "probes")) {
+            auto object = Json::requireObject(value);
+
+            Entry entry;
+            entry.size = static_cast<qint64>(Json::requireDouble(object, "size"));
+            entry.modified = static_cast<qint64>(Json::requireDouble(object, "modified"));
+            entry.result.validity = JavaChecker::Result::Validity::Valid;
+            entry.result.javaVersion = Json::requireString(object, "version");
+            entry.result.javaVendor = Json::requireString(object, "vendor");
+            entry.result.realPlatform = Json::requireString(object, "arch");
+            entry.result.is_64bit = Json::requireBoolean(object, "is64bit");
+            entry.result.mojangPlatform = entry.result.is_64bit ? "64" : "32";
+
+            m_entries.insert(Json::requireString(object, "path"), entry);
+        }
+    } catch (const Exception& e) {
+        qWarning() << "Could not read the Java probe cache, starting from scratch:" << e.cause();
+        m_entries.clear();
+    }
+}
+
+std::optional<JavaChecker::Result> Cache::find(const QString& path)
+{
+    QFileInfo binary(QFileInfo(path).canonicalFilePath());
+    if (!binary.exists())
+        return {};
+
+    QMutexLocker locker(&m_lock);
+    auto entry = m_entries.constFind(binary.absoluteFilePath());
+    if (entry == m_entries.constEnd() || entry->size != binary.size() ||
+        entry->modified != binary.lastModified().toMSecsSinceEpoch())
+        return {};
+
+    auto result = entry->result;
+    result.path = path;
+    return result;
+}
+
+void Cache::insert(const JavaChecker::Result& result)
+{
+    if (result.validity != JavaChecker::Result::Validity::Valid)
+        return;
+
+    QFileInfo binary(QFileInfo(result.path).canonicalFilePath());
+    if (!binary.exists())
+        return;
+
+    QMutexLocker locker(&m_lock);
+    m_entries.insert(binary.absoluteFilePath(), { binary.size(), binary.lastModified().toMSecsSinceEpoch(), result });
+    save();
+}
+
+void Cache::save()
+{
+    if (m_file_path.isEmpty())
+        return;
+
+    QJsonArray probes;
+    for (auto it = m_entries.constBegin(); it != m_entries.constEnd(); ++it) {
+        QJsonObject object;
+        object.insert("path", it.key());
+        object.insert("size", static_cast<double>(it->size));
+        object.insert("modified", static_cast<double>(it->modified));
+        object.insert("version", it->result.javaVersion.toString());
+        object.insert("vendor", it->result.javaVendor);
+        object.insert("arch", it->result.realPlatform);
+        object.insert("is64bit", it->result.is_64bit);
+        probes.append(object);
+    }
+
+    QJsonObject root;
+    root.insert("formatVersion", 1);
+    root.insert("probes", probes);
+
+    try {
+        FS::ensureFilePathExists(m_file_path);
+        Json::write(root, m_file_path);
+    } catch (const Exception& e) {
+        qWarning() << "Could not write the Java probe cache:" << e.cause();
+    }
+}
+
+}  // namespace JavaProbe
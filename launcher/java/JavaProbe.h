@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QHash>
+#include <QMap>
+#include <QMutex>
+#include <QString>
+
+#include <optional>
+
+#include "java/JavaChecker.h"
+
+/** Ways of finding out about a Java binary without running JavaCheck in it. */
+namespace JavaProbe {
+
+/** Maps the many names of an architecture (amd64, x86_64, i686, arm64...) to a single one. */
+QString normalizeArch(const QString& arch);
+
+/** Whether 'arch', under any of its names, is a 64-bit architecture. */
+bool is64BitArch(const QString& arch);
+
+/** Reads the executable header of 'path' (ELF, PE or Mach-O), and returns the architecture as the JVM would report it
+ *  in 'os.arch'. Returns an empty string when the format or the architecture isn't known. */
+QString binaryArchitecture(const QString& path);
+
+/** Parses the 'release' file that ships with JDKs and JREs, at the root of 'java_home'. */
+QMap<QString, QString> readReleaseFile(const QString& java_home);
+
+/** Tries to fill a checker result for the binary at 'path' only from its release file and executable header.
+ *  Returns nothing if anything about it is uncertain, in which case the JVM needs to be run. */
+std::optional<JavaChecker::Result> probeWithoutJvm(const QString& path);
+
+/** Launcher-wide cache of JavaCheck results, kept on disk, so each binary only ever needs to be started once.
+ *  Entries are keyed by the binary's canonical path, and only used while its size and modification time stay the same. */
+class Cache {
+   public:
+    static Cache& instance();
+
+    std::optional<JavaChecker::Result> find(const QString& path);
+    void insert(const JavaChecker::Result& result);
+
+   private:
+    Cache();
+    void save();
+
+    struct Entry {
+        qint64 size;
+        qint64 modified;
+        JavaChecker::Result result;
+    };
+
+    QMutex m_lock;
+    QHash<QString, Entry> m_entries;
+    QString m_file_path;
+};
+
+}  // namespace JavaProbe
@@ -15,6 +15,13 @@
 
 #include "BaseEntity.h"
 
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+
+#include <optional>
+
 #include "Exception.h"
 #include "FileSystem.h"
 #include "Json.h"
@@ -31,6 +38,57 @@
 
 namespace Meta {
 
+namespace {
+
+constexpr quint32 s_snapshot_magic = 0x504d534e;  // "PMSN"
+
+struct Snapshot {
+    QString sha256;
+    QByteArray data;
+};
+
+QString snapshotPath(const BaseEntity* entity)
+{
+    return QDir("cache/meta").absoluteFilePath(entity->localFilename() + ".bin");
+}
+
+/** Returns the snapshot taken from 'file', as long as the file hasn't changed since. */
+std::optional<Snapshot> readSnapshot(const QString& path, const QFileInfo& file)
+{
+    QFile input(path);
+    if (!input.open(QIODevice::ReadOnly))
+        return {};
+
+    QDataStream in(&input);
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 magic;
+    qint64 size, modified;
+    Snapshot snapshot;
+    in >> magic >> size >> modified >> snapshot.sha256 >> snapshot.data;
+    if (in.status() != QDataStream::Ok || magic != s_snapshot_magic || size != file.size() ||
+        modified != file.lastModified().toMSecsSinceEpoch() || snapshot.sha256.isEmpty())
+        return {};
+    return snapshot;
+}
+
+void writeSnapshot(const QString& path, const QFileInfo& file, const QString& sha256, const QByteArray& data)
+{
+    if (data.isEmpty() || sha256.isEmpty())
+        return;
+
+    QByteArray output;
+    QDataStream out(&output, QIODevice::WriteOnly);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << s_snapshot_magic << file.size() << file.lastModified().toMSecsSinceEpoch() << sha256 << data;
+    try {
+        FS::write(path, output);
+    } catch (const Exception& e) {
+        qWarning() << "Unable to store meta snapshot:" << e.cause();
+    }
+}
+
+}  // namespace
+
 class ParsingValidator : public Net::Validator {
    public: /* con/des */
     ParsingValidator(BaseEntity* entity) : m_entity(entity) {};
@@ -56,9 +114,7 @@ class ParsingValidator : public Net::Validator {
     {
         auto fname = m_entity->localFilename();
         try {
-            auto doc = Json::requireDocument(m_data, fname);
-            auto obj = Json::requireObject(doc, fname);
-            m_entity->parse(obj);
+            m_entity->m_downloaded_snapshot = m_entity->parseDataWithSnapshot(m_data, fname);
             return true;
         } catch (const Exception& e) {
             qWarning() << "Unable to parse response:" << e.cause();
@@ -71,6 +127,12 @@ class ParsingValidator : public Net::Validator {
     BaseEntity* m_entity;
 };
 
+QByteArray BaseEntity::parseDataWithSnapshot(const QByteArray& data, const QString& what)
+{
+    auto doc = Json::requireDocument(data, what);
+    return parseWithSnapshot(Json::requireObject(doc, what));
+}
+
 QUrl BaseEntity::url() const
 {
     auto s = APPLICATION->settings();
@@ -111,16 +173,24 @@ BaseEntityLoadTask::BaseEntityLoadTask(BaseEntity* parent, Net::Mode mode) : m_e
 void BaseEntityLoadTask::executeTask()
 {
     const QString fname = QDir("meta").absoluteFilePath(m_entity->localFilename());
+    const QString snapshot_path = snapshotPath(m_entity);
     auto hashMatches = false;
     // the file exists on disk try to load it
     if (QFile::exists(fname)) {
         try {
             QByteArray fileData;
+            std::optional<Snapshot> snapshot;
             // read local file if nothing is loaded yet
             if (m_entity->m_load_status == BaseEntity::LoadStatus::NotLoaded || m_entity->m_file_sha256.isEmpty()) {
                 setStatus(tr("Loading local file"));
-                fileData = FS::read(fname);
-                m_entity->m_file_sha256 = Hashing::hash(fileData, Hashing::Algorithm::Sha256);
+                // a snapshot of the file as it is now saves reading, hashing and parsing it
+                snapshot = readSnapshot(snapshot_path, QFileInfo(fname));
+                if (snapshot) {
+                    m_entity->m_file_sha256 = snapshot->sha256;
+                } else {
+                    fileData = FS::read(fname);
+                    m_entity->m_file_sha256 = Hashing::hash(fileData, Hashing::Algorithm::Sha256);
+                }
             }
 
             // on online the hash needs to match
@@ -131,9 +201,12 @@ void BaseEntityLoadTask::executeTask()
 
             // load local file
             if (m_entity->m_load_status == BaseEntity::LoadStatus::NotLoaded) {
-                auto doc = Json::requireDocument(fileData, fname);
-                auto obj = Json::requireObject(doc, fname);
-                m_entity->parse(obj);
+                if (!snapshot || !m_entity->loadSnapshot(snapshot->data)) {
+                    if (fileData.isEmpty())
+                        fileData = FS::read(fname);
+                    writeSnapshot(snapshot_path, QFileInfo(fname), m_entity->m_file_sha256,
+                                  m_entity->parseDataWithSnapshot(fileData, fname));
+                }
                 m_entity->m_load_status = BaseEntity::LoadStatus::Local;
             }
 
@@ -168,9 +241,12 @@ void BaseEntityLoadTask::executeTask()
     m_task->setAskRetry(false);
     connect(m_task.get(), &Task::failed, this, &BaseEntityLoadTask::emitFailed);
     connect(m_task.get(), &Task::succeeded, this, &BaseEntityLoadTask::emitSucceeded);
-    connect(m_task.get(), &Task::succeeded, this, [this]() {
+    connect(m_task.get(), &Task::succeeded, this, [this, fname, snapshot_path]() {
         m_entity->m_load_status = BaseEntity::LoadStatus::Remote;
         m_entity->m_file_sha256 = m_entity->m_sha256;
+        // the download is stored by now, so the snapshot can point at it
+        writeSnapshot(snapshot_path, QFileInfo(fname), m_entity->m_file_sha256, m_entity->m_downloaded_snapshot);
+        m_entity->m_downloaded_snapshot.clear();
     });
 
     connect(m_task.get(), &Task::progress, this, &Task::setProgress);
@@ -24,8 +24,10 @@
 
 namespace Meta {
 class BaseEntityLoadTask;
+class ParsingValidator;
 class BaseEntity {
     friend BaseEntityLoadTask;
+    friend ParsingValidator;
 
    public: /* types */
     using Ptr = std::shared_ptr<BaseEntity>;
@@ -41,10 +43,25 @@ class BaseEntity {
 
     /* for parsers */
     void setSha256(QString sha256);
+    QString sha256() const { return m_sha256; }
 
     virtual void parse(const QJsonObject& obj) = 0;
     [[nodiscard]] Task::Ptr loadTask(Net::Mode loadType = Net::Mode::Online);
 
+    /* Binary snapshots, which let later loads skip the JSON. Entities that don't have them get an empty snapshot
+     * and can't load one, so they are always parsed from JSON. */
+    /** Like parse(), but also returns a snapshot of what was parsed. */
+    virtual QByteArray parseWithSnapshot(const QJsonObject& obj)
+    {
+        parse(obj);
+        return {};
+    }
+    /** Like parseWithSnapshot(), but from the file as it is. Entities with large files can read them without building a
+     *  QJsonDocument first. @throw Exception */
+    virtual QByteArray parseDataWithSnapshot(const QByteArray& data, const QString& what);
+    /** Loads what parseWithSnapshot() returned, as if the JSON had been parsed again. */
+    virtual bool loadSnapshot([[maybe_unused]] const QByteArray& snapshot) { return false; }
+
    protected:
     QString m_sha256;       // the expected sha256
     QString m_file_sha256;  // the file sha256
@@ -52,6 +69,8 @@ class BaseEntity {
    private:
     LoadStatus m_load_status = LoadStatus::NotLoaded;
     Task::Ptr m_task;
+    // snapshot of a downloaded file, written once the download is stored
+    QByteArray m_downloaded_snapshot;
 };
 
 class BaseEntityLoadTask : public Task {
@@ -0,0 +1,180 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "BinaryFormat.h"
+
+#include <QDataStream>
+#include <QIODevice>
+
+#include "Index.h"
+#include "Version.h"
+#include "VersionList.h"
+
+namespace Meta {
+
+namespace {
+
+// Bump whenever the layout or what the JSON parsers read changes, so old snapshots get parsed from JSON again
+constexpr quint32 s_format_version = 1;
+
+enum class Kind : quint8 {
+    Index = 1,
+    VersionList = 2,
+};
+
+class SnapshotWriter {
+   public:
+    explicit SnapshotWriter(Kind kind) : m_stream(&m_data, QIODevice::WriteOnly)
+    {
+        m_stream.setVersion(QDataStream::Qt_5_12);
+        m_stream << s_format_version << static_cast<quint8>(kind);
+    }
+
+    QDataStream& stream() { return m_stream; }
+    QByteArray data() const { return m_data; }
+
+   private:
+    QByteArray m_data;
+    QDataStream m_stream;
+};
+
+/** Reads the header and leaves the stream at the payload, or in a failed state if the header doesn't match. */
+void openSnapshot(QDataStream& in, Kind kind)
+{
+    in.setVersion(QDataStream::Qt_5_12);
+    quint32 format_version;
+    quint8 stored_kind;
+    in >> format_version >> stored_kind;
+    if (format_version != s_format_version || stored_kind != static_cast<quint8>(kind))
+        in.setStatus(QDataStream::ReadCorruptData);
+}
+
+void writeRequires(QDataStream& out, const RequireSet& reqs)
+{
+    out << static_cast<quint32>(reqs.size());
+    for (auto& require : reqs)
+        out << require.uid << require.equalsVersion << require.suggests;
+}
+
+RequireSet readRequires(QDataStream& in)
+{
+    RequireSet reqs;
+    quint32 count;
+    in >> count;
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; i++) {
+        Require require;
+        in >> require.uid >> require.equalsVersion >> require.suggests;
+        reqs.insert(require);
+    }
+    return reqs;
+}
+
+}  // namespace
+
+QByteArray writeIndexSnapshot(const Index& index)
+{
+    SnapshotWriter writer(Kind::Index);
+    auto& out = writer.stream();
+
+    auto lists = index.lists();
+    out << static_cast<quint32>(lists.size());
+    for (auto& list : lists)
+        out << list->uid() << list->name() << list->sha256();
+    return writer.data();
+}
+
+std::shared_ptr<Index> readIndexSnapshot(const QByteArray& data)
+{
+    QDataStream in(data);
+    openSnapshot(in, Kind::Index);
+
+    quint32 count = 0;
+    in >> count;
+    QVector<VersionList::Ptr> lists;
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; i++) {
+        QString uid, name, sha256;
+        in >> uid >> name >> sha256;
+        auto list = std::make_shared<VersionList>(uid);
+        list->setName(name);
+        list->setSha256(sha256);
+        lists.append(list);
+    }
+
+    if (in.status() != QDataStream::Ok)
+        return nullptr;
+    return std::make_shared<Index>(lists);
+}
+
+QByteArray writeVersionListSnapshot(const VersionList& list)
+{
+    SnapshotWriter writer(Kind::VersionList);
+    auto& out = writer.stream();
+
+    out << list.uid() << list.name();
+    auto versions = list.versions();
+    out << static_cast<quint32>(versions.size());
+    for (auto& version : versions) {
+        out << version->version() << version->rawTime() << version->type() << version->isRecommended() << version->isVolatile()
+            << version->sha256();
+        writeRequires(out, version->requiredSet());
+        writeRequires(out, version->conflictsSet());
+    }
+    return writer.data();
+}
+
+std::shared_ptr<VersionList> readVersionListSnapshot(const QByteArray& data)
+{
+    QDataStream in(data);
+    openSnapshot(in, Kind::VersionList);
+
+    QString uid, name;
+    quint32 count = 0;
+    in >> uid >> name >> count;
+
+    QVector<Version::Ptr> versions;
+    versions.reserve(in.status() == QDataStream::Ok ? static_cast<int>(qMin<quint32>(count, 100000)) : 0);
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; i++) {
+        QString id, type, sha256;
+        qint64 time;
+        bool recommended, is_volatile;
+        in >> id >> time >> type >> recommended >> is_volatile >> sha256;
+        auto reqs = readRequires(in);
+        auto conflicts = readRequires(in);
+
+        // the same as parsing a version out of a list
+        auto version = std::make_shared<Version>(uid, id);
+        version->setTime(time);
+        version->setType(type);
+        version->setRecommended(recommended);
+        version->setVolatile(is_volatile);
+        version->setRequires(reqs, conflicts);
+        if (!sha256.isEmpty())
+            version->setSha256(sha256);
+        version->setProvidesRecommendations();
+        versions.append(version);
+    }
+
+    if (in.status() != QDataStream::Ok)
+        return nullptr;
+
+    auto list = std::make_shared<VersionList>(uid);
+    list->setName(name);
+    list->setVersions(versions);
+    return list;
+}
+
+}  // namespace Meta
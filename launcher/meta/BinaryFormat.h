@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+
+#include <memory>
+
+namespace Meta {
+class Index;
+class VersionList;
+
+/* Binary snapshots of parsed meta files, which load again without any JSON parsing.
+ * They only hold what the JSON parsers read, so loading one gives the same entity as parsing the file.
+ * The readers return nullptr if the snapshot is broken or from a different format version. */
+
+QByteArray writeIndexSnapshot(const Index& index);
+std::shared_ptr<Index> readIndexSnapshot(const QByteArray& data);
+
+QByteArray writeVersionListSnapshot(const VersionList& list);
+std::shared_ptr<VersionList> readVersionListSnapshot(const QByteArray& data);
+
+}  // namespace Meta
@@ -15,6 +15,7 @@
 
 #include "Index.h"
 
+#include "BinaryFormat.h"
 #include "JsonFormat.h"
 #include "QObjectPtr.h"
 #include "VersionList.h"
@@ -101,6 +102,23 @@ void Index::parse(const QJsonObject& obj)
     parseIndex(obj, this);
 }
 
+QByteArray Index::parseWithSnapshot(const QJsonObject& obj)
+{
+    auto parsed = parseIndex(obj);
+    auto snapshot = writeIndexSnapshot(*parsed);
+    merge(parsed);
+    return snapshot;
+}
+
+bool Index::loadSnapshot(const QByteArray& snapshot)
+{
+    auto parsed = readIndexSnapshot(snapshot);
+    if (!parsed)
+        return false;
+    merge(parsed);
+    return true;
+}
+
 void Index::merge(const std::shared_ptr<Index>& other)
 {
     const QVector<VersionList::Ptr> lists = other->m_lists;
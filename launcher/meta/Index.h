@@ -58,6 +58,8 @@ class Index : public QAbstractListModel, public BaseEntity {
 
    protected:
     void parse(const QJsonObject& obj) override;
+    QByteArray parseWithSnapshot(const QJsonObject& obj) override;
+    bool loadSnapshot(const QByteArray& snapshot) override;
 
    private:
     QVector<VersionList::Ptr> m_lists;
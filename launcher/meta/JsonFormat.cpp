@@ -17,6 +17,7 @@
 
 // FIXME: remove this from here... somehow
 #include "Json.h"
+#include "JsonReader.h"
 #include "minecraft/OneSixVersionFormat.h"
 
 #include "Index.h"
@@ -94,6 +95,171 @@ static VersionList::Ptr parseVersionListInternal(const QJsonObject& obj)
     return list;
 }
 
+// Version lists straight from the data, as some of them are several MB and get turned into versions right away.
+// These follow the same rules as the helpers used on QJsonObjects above.
+namespace {
+QString readStringOr(Reader& reader, const QString& default_ = QString())
+{
+    if (reader.peek() == Reader::Type::String)
+        return reader.readString();
+    reader.skip();
+    return default_;
+}
+
+bool readBoolOr(Reader& reader, bool default_)
+{
+    if (reader.peek() == Reader::Type::Bool)
+        return reader.readBool();
+    reader.skip();
+    return default_;
+}
+
+void readRequires(Reader& reader, RequireSet* ptr)
+{
+    reader.beginArray();
+    while (reader.nextElement()) {
+        Require req;
+        bool hasUid = false;
+        reader.beginObject();
+        std::string_view key;
+        while (reader.nextKey(key)) {
+            if (key == "uid") {
+                req.uid = reader.readString();
+                hasUid = true;
+            } else if (key == "equals") {
+                req.equalsVersion = readStringOr(reader);
+            } else if (key == "suggests") {
+                req.suggests = readStringOr(reader);
+            } else {
+                reader.skip();
+            }
+        }
+        if (!hasUid)
+            throw JsonException("A requirement has no 'uid'");
+        ptr->insert(req);
+    }
+}
+
+// The uid of the list can come after its versions, so these get created once the whole list is read
+struct ListedVersion {
+    QString version;
+    QString releaseTime;
+    QString type;
+    QString sha256;
+    bool recommended = false;
+    bool isVolatile = false;
+    bool hasVersion = false;
+    bool hasReleaseTime = false;
+    RequireSet reqs;
+    RequireSet conflicts;
+};
+
+ListedVersion readListedVersion(Reader& reader)
+{
+    ListedVersion out;
+    reader.beginObject();
+    std::string_view key;
+    while (reader.nextKey(key)) {
+        if (key == "version") {
+            out.version = reader.readString();
+            out.hasVersion = true;
+        } else if (key == "releaseTime") {
+            out.releaseTime = reader.readString();
+            out.hasReleaseTime = true;
+        } else if (key == "type") {
+            out.type = readStringOr(reader);
+        } else if (key == "sha256") {
+            out.sha256 = readStringOr(reader);
+        } else if (key == "recommended") {
+            out.recommended = readBoolOr(reader, false);
+        } else if (key == "volatile") {
+            out.isVolatile = readBoolOr(reader, false);
+        } else if (key == "requires") {
+            readRequires(reader, &out.reqs);
+        } else if (key == "conflicts") {
+            readRequires(reader, &out.conflicts);
+        } else {
+            reader.skip();
+        }
+    }
+    if (!out.hasVersion)
+        throw JsonException("A version has no 'version'");
+    if (!out.hasReleaseTime)
+        throw JsonException(QString("Version %1 has no 'releaseTime'").arg(out.version));
+    return out;
+}
+}  // namespace
+
+std::shared_ptr<VersionList> parseVersionList(const QByteArray& data, const QString& what)
+{
+    Reader reader(data, what);
+    QString uid;
+    QString name;
+    bool hasUid = false;
+    bool hasVersions = false;
+    auto formatVersion = MetadataVersion::Invalid;
+    std::vector<ListedVersion> listed;
+
+    reader.beginObject();
+    std::string_view key;
+    while (reader.nextKey(key)) {
+        if (key == "formatVersion") {
+            if (reader.peek() == Reader::Type::Number) {
+                auto number = reader.readInteger();
+                formatVersion = number == 0 || number == 1 ? MetadataVersion::InitialRelease : MetadataVersion::Invalid;
+            } else {
+                reader.skip();
+                formatVersion = MetadataVersion::Invalid;
+            }
+        } else if (key == "uid") {
+            uid = reader.readString();
+            hasUid = true;
+        } else if (key == "name") {
+            name = readStringOr(reader);
+        } else if (key == "versions") {
+            // anything but an array counts as no versions at all
+            if (reader.peek() == Reader::Type::Array) {
+                reader.beginArray();
+                while (reader.nextElement())
+                    listed.push_back(readListedVersion(reader));
+            } else {
+                reader.skip();
+            }
+            hasVersions = true;
+        } else {
+            reader.skip();
+        }
+    }
+    reader.end();
+
+    if (formatVersion == MetadataVersion::Invalid)
+        throw ParseException(QObject::tr("Unknown format version!"));
+    if (!hasUid)
+        throw JsonException(what + ": missing 'uid'");
+    if (!hasVersions)
+        throw JsonException(what + ": missing 'versions'");
+
+    QVector<Version::Ptr> versions;
+    versions.reserve(static_cast<int>(listed.size()));
+    for (auto& entry : listed) {
+        auto version = std::make_shared<Version>(uid, entry.version);
+        version->setTime(QDateTime::fromString(entry.releaseTime, Qt::ISODate).toMSecsSinceEpoch() / 1000);
+        version->setType(entry.type);
+        version->setRecommended(entry.recommended);
+        version->setVolatile(entry.isVolatile);
+        version->setRequires(entry.reqs, entry.conflicts);
+        if (!entry.sha256.isEmpty())
+            version->setSha256(entry.sha256);
+        version->setProvidesRecommendations();
+        versions.append(version);
+    }
+
+    VersionList::Ptr list = std::make_shared<VersionList>(uid);
+    list->setName(name);
+    list->setVersions(versions);
+    return list;
+}
+
 MetadataVersion parseFormatVersion(const QJsonObject& obj, bool required)
 {
     if (!obj.contains("formatVersion")) {
@@ -122,28 +288,38 @@ void serializeFormatVersion(QJsonObject& obj, Meta::MetadataVersion version)
     obj.insert("formatVersion", int(version));
 }
 
-void parseIndex(const QJsonObject& obj, Index* ptr)
+std::shared_ptr<Index> parseIndex(const QJsonObject& obj)
 {
     const MetadataVersion version = parseFormatVersion(obj);
     switch (version) {
         case MetadataVersion::InitialRelease:
-            ptr->merge(parseIndexInternal(obj));
-            break;
+            return parseIndexInternal(obj);
         case MetadataVersion::Invalid:
-            throw ParseException(QObject::tr("Unknown format version!"));
+            break;
     }
+    throw ParseException(QObject::tr("Unknown format version!"));
 }
 
-void parseVersionList(const QJsonObject& obj, VersionList* ptr)
+void parseIndex(const QJsonObject& obj, Index* ptr)
+{
+    ptr->merge(parseIndex(obj));
+}
+
+std::shared_ptr<VersionList> parseVersionList(const QJsonObject& obj)
 {
     const MetadataVersion version = parseFormatVersion(obj);
     switch (version) {
         case MetadataVersion::InitialRelease:
-            ptr->merge(parseVersionListInternal(obj));
-            break;
+            return parseVersionListInternal(obj);
         case MetadataVersion::Invalid:
-            throw ParseException(QObject::tr("Unknown format version!"));
+            break;
     }
+    throw ParseException(QObject::tr("Unknown format version!"));
+}
+
+void parseVersionList(const QJsonObject& obj, VersionList* ptr)
+{
+    ptr->merge(parseVersionList(obj));
 }
 
 void parseVersion(const QJsonObject& obj, Version* ptr)
@@ -15,8 +15,10 @@
 
 #pragma once
 
+#include <QByteArray>
 #include <QJsonObject>
 
+#include <memory>
 #include <set>
 #include "Exception.h"
 
@@ -46,6 +48,12 @@ void parseIndex(const QJsonObject& obj, Index* ptr);
 void parseVersion(const QJsonObject& obj, Version* ptr);
 void parseVersionList(const QJsonObject& obj, VersionList* ptr);
 
+// return what was parsed, instead of merging it into an existing entity
+std::shared_ptr<Index> parseIndex(const QJsonObject& obj);
+std::shared_ptr<VersionList> parseVersionList(const QJsonObject& obj);
+/** Same as above, but reads the document itself without building a QJsonDocument first. @throw Exception */
+std::shared_ptr<VersionList> parseVersionList(const QByteArray& data, const QString& what);
+
 MetadataVersion parseFormatVersion(const QJsonObject& obj, bool required = true);
 void serializeFormatVersion(QJsonObject& obj, MetadataVersion version);
 
@@ -19,6 +19,7 @@
 #include <algorithm>
 
 #include "Application.h"
+#include "BinaryFormat.h"
 #include "Index.h"
 #include "JsonFormat.h"
 #include "Version.h"
@@ -192,6 +193,32 @@ void VersionList::parse(const QJsonObject& obj)
     parseVersionList(obj, this);
 }
 
+QByteArray VersionList::parseWithSnapshot(const QJsonObject& obj)
+{
+    auto parsed = parseVersionList(obj);
+    auto snapshot = writeVersionListSnapshot(*parsed);
+    merge(parsed);
+    return snapshot;
+}
+
+QByteArray VersionList::parseDataWithSnapshot(const QByteArray& data, const QString& what)
+{
+    // the biggest lists are only turned into versions, so they skip QJsonDocument
+    auto parsed = parseVersionList(data, what);
+    auto snapshot = writeVersionListSnapshot(*parsed);
+    merge(parsed);
+    return snapshot;
+}
+
+bool VersionList::loadSnapshot(const QByteArray& snapshot)
+{
+    auto parsed = readVersionListSnapshot(snapshot);
+    if (!parsed)
+        return false;
+    merge(parsed);
+    return true;
+}
+
 void VersionList::addExternalRecommends(const QStringList& recommends)
 {
     m_externalRecommendsVersions.append(recommends);
@@ -72,6 +72,9 @@ class VersionList : public BaseVersionList, public BaseEntity {
     void merge(const VersionList::Ptr& other);
     void mergeFromIndex(const VersionList::Ptr& other);
     void parse(const QJsonObject& obj) override;
+    QByteArray parseWithSnapshot(const QJsonObject& obj) override;
+    QByteArray parseDataWithSnapshot(const QByteArray& data, const QString& what) override;
+    bool loadSnapshot(const QByteArray& snapshot) override;
     void addExternalRecommends(const QStringList& recommends);
     void clearExternalRecommends();
 
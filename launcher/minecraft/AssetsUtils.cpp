@@ -38,14 +38,11 @@
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
-#include <QJsonDocument>
-#include <QJsonObject>
-#include <QJsonParseError>
-#include <QVariant>
 
 #include "AssetsUtils.h"
 #include "BuildConfig.h"
 #include "FileSystem.h"
+#include "JsonReader.h"
 #include "net/ApiDownload.h"
 #include "net/ChecksumValidator.h"
 #include "net/Download.h"
@@ -112,58 +109,43 @@ bool loadAssetsIndexJson(const QString& assetsId, const QString& path, AssetsInd
     QByteArray jsonData = file.readAll();
     file.close();
 
-    QJsonParseError parseError;
-    QJsonDocument jsonDoc = QJsonDocument::fromJson(jsonData, &parseError);
-
-    // Fail if the JSON is invalid.
-    if (parseError.error != QJsonParseError::NoError) {
-        qCritical() << "Failed to parse assets index file:" << parseError.errorString() << "at offset "
-                    << QString::number(parseError.offset);
-        return false;
-    }
-
-    // Make sure the root is an object.
-    if (!jsonDoc.isObject()) {
-        qCritical() << "Invalid assets index JSON: Root should be an array.";
-        return false;
-    }
-
-    QJsonObject root = jsonDoc.object();
-
-    QJsonValue isVirtual = root.value("virtual");
-    if (!isVirtual.isUndefined()) {
-        index.isVirtual = isVirtual.toBool(false);
-    }
-
-    QJsonValue mapToResources = root.value("map_to_resources");
-    if (!mapToResources.isUndefined()) {
-        index.mapToResources = mapToResources.toBool(false);
-    }
-
-    QJsonValue objects = root.value("objects");
-    QVariantMap map = objects.toVariant().toMap();
-
-    for (QVariantMap::const_iterator iter = map.begin(); iter != map.end(); ++iter) {
-        // qDebug() << iter.key();
-
-        QVariant variant = iter.value();
-        QVariantMap nested_objects = variant.toMap();
-
-        AssetObject object;
-
-        for (QVariantMap::const_iterator nested_iter = nested_objects.begin(); nested_iter != nested_objects.end(); ++nested_iter) {
-            // qDebug() << nested_iter.key() << nested_iter.value().toString();
-            QString key = nested_iter.key();
-            QVariant value = nested_iter.value();
-
-            if (key == "hash") {
-                object.hash = value.toString();
-            } else if (key == "size") {
-                object.size = value.toDouble();
+    // Indexes have thousands of objects, so read them as they come instead of building a QJsonDocument first
+    try {
+        Json::Reader reader(jsonData, "Assets index " + path);
+        reader.beginObject();
+        std::string_view key;
+        while (reader.nextKey(key)) {
+            if (key == "virtual" && reader.peek() == Json::Reader::Type::Bool) {
+                index.isVirtual = reader.readBool();
+            } else if (key == "map_to_resources" && reader.peek() == Json::Reader::Type::Bool) {
+                index.mapToResources = reader.readBool();
+            } else if (key == "objects" && reader.peek() == Json::Reader::Type::Object) {
+                reader.beginObject();
+                std::string_view name;
+                while (reader.nextKey(name)) {
+                    auto objectName = QString::fromUtf8(name.data(), static_cast<int>(name.size()));
+                    AssetObject object{};
+                    reader.beginObject();
+                    std::string_view field;
+                    while (reader.nextKey(field)) {
+                        if (field == "hash" && reader.peek() == Json::Reader::Type::String) {
+                            object.hash = reader.readString();
+                        } else if (field == "size" && reader.peek() == Json::Reader::Type::Number) {
+                            object.size = reader.readInteger();
+                        } else {
+                            reader.skip();
+                        }
+                    }
+                    index.objects.insert(objectName, object);
+                }
+            } else {
+                reader.skip();
             }
         }
-
-        index.objects.insert(iter.key(), object);
+        reader.end();
+    } catch (const Json::JsonException& e) {
+        qCritical() << "Failed to parse assets index file:" << e.cause();
+        return false;
     }
 
     return true;
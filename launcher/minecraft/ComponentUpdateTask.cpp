@@ -44,6 +44,11 @@ ComponentUpdateTask::ComponentUpdateTask(Mode mode, Net::Mode netmode, PackProfi
     d->m_profile = list;
     d->mode = mode;
     d->netmode = netmode;
+    connect(this, &Task::finished, this, [this] {
+        qCDebug(instanceProfileResolveC) << d->m_profile->d->m_instance->name() << "|"
+                                         << "Component resolution took" << d->rounds << "round(s) of loading and" << d->timer.elapsed()
+                                         << "ms, with" << d->prefetches.size() << "requirement(s) prefetched";
+    });
 }
 
 ComponentUpdateTask::~ComponentUpdateTask() {}
@@ -51,6 +56,8 @@ ComponentUpdateTask::~ComponentUpdateTask() {}
 void ComponentUpdateTask::executeTask()
 {
     qCDebug(instanceProfileResolveC) << "Loading components";
+    d->timer.start();
+    d->rounds = 0;
     loadComponents();
 }
 
@@ -65,7 +72,7 @@ LoadResult composeLoadResult(LoadResult a, LoadResult b)
     return a;
 }
 
-static LoadResult loadComponent(ComponentPtr component, Task::Ptr& loadTask, Net::Mode netmode)
+static LoadResult loadComponent(ComponentPtr component, Task::Ptr& loadTask, Net::Mode netmode, const QHash<QString, Task::Ptr>& prefetches)
 {
     if (component->m_loaded) {
         qCDebug(instanceProfileResolveC) << component->getName() << "is already loaded";
@@ -81,6 +88,7 @@ static LoadResult loadComponent(ComponentPtr component, Task::Ptr& loadTask, Net
         bool fileChanged = false;
         auto file = ProfileUtils::parseJsonFile(QFileInfo(customPatchFilename), false);
         if (file->uid != component->m_uid) {
+            file = std::make_shared<VersionFile>(*file);
             file->uid = component->m_uid;
             fileChanged = true;
         }
@@ -98,6 +106,10 @@ static LoadResult loadComponent(ComponentPtr component, Task::Ptr& loadTask, Net
         if (metaVersion->isLoaded()) {
             component->m_loaded = true;
             result = LoadResult::LoadedLocal;
+        } else if (auto prefetch = prefetches.value(component->m_uid + ':' + component->m_version); prefetch && prefetch->isRunning()) {
+            // still being prefetched, so wait for that instead of starting a load that would join the same entity loads
+            loadTask = prefetch;
+            result = LoadResult::RequiresRemote;
         } else {
             loadTask = APPLICATION->metadataIndex()->loadVersion(component->m_uid, component->m_version, netmode);
             loadTask->start();
@@ -147,6 +159,7 @@ void ComponentUpdateTask::loadComponents()
     size_t taskIndex = 0;
     size_t componentIndex = 0;
     d->remoteLoadSuccessful = true;
+    d->rounds++;
 
     // load all the components OR their lists...
     for (auto component : d->m_profile->d->components) {
@@ -173,11 +186,12 @@ void ComponentUpdateTask::loadComponents()
             }
         }
 #else
-        singleResult = loadComponent(component, loadTask, d->netmode);
+        singleResult = loadComponent(component, loadTask, d->netmode, d->prefetches);
         loadType = RemoteLoadStatus::Type::Version;
 #endif
         if (singleResult == LoadResult::LoadedLocal) {
             component->updateCachedData();
+            prefetchRequirements(component->m_cachedRequires);
         }
         result = composeLoadResult(result, singleResult);
         if (loadTask) {
@@ -384,6 +398,66 @@ static bool getTrivialComponentChanges(const ComponentIndex& index, const Requir
     return succeeded;
 }
 
+/// The version a missing requirement gets added with
+static QString versionForRequirement(const Meta::Require& req, const ComponentContainer& components)
+{
+    if (!req.equalsVersion.isEmpty()) {
+        return req.equalsVersion;
+    }
+    // ############################################################################################################
+    // HACK HACK HACK HACK FIXME: this is a placeholder for deciding what version to use. For now, it is hardcoded.
+    if (!req.suggests.isEmpty()) {
+        return req.suggests;
+    }
+    if (req.uid == "org.lwjgl") {
+        return "2.9.1";
+    }
+    if (req.uid == "org.lwjgl3") {
+        return "3.1.2";
+    }
+    if (req.uid == "net.fabricmc.intermediary" || req.uid == "org.quiltmc.hashed") {
+        auto minecraft =
+            std::find_if(components.begin(), components.end(), [](const ComponentPtr& cmp) { return cmp->getID() == "net.minecraft"; });
+        if (minecraft != components.end()) {
+            return (*minecraft)->getVersion();
+        }
+    }
+    // HACK HACK HACK HACK FIXME: this is a placeholder for deciding what version to use. For now, it is hardcoded.
+    // ############################################################################################################
+    return {};
+}
+
+void ComponentUpdateTask::prefetchRequirements(const Meta::RequireSet& reqs)
+{
+    // only worth it when the missing requirements are going to be added, and there's something to download
+    if (d->mode != Mode::Resolution || d->netmode != Net::Mode::Online) {
+        return;
+    }
+
+    auto& components = d->m_profile->d->components;
+    auto& componentIndex = d->m_profile->d->componentIndex;
+    for (const auto& req : reqs) {
+        auto existing = componentIndex.find(req.uid);
+        if (existing != componentIndex.end() && (req.equalsVersion.isEmpty() || (*existing)->getVersion() == req.equalsVersion)) {
+            continue;
+        }
+        auto version = versionForRequirement(req, components);
+        auto key = req.uid + ':' + version;
+        if (version.isEmpty() || d->prefetches.contains(key)) {
+            continue;
+        }
+
+        qCDebug(instanceProfileResolveC) << "Prefetching" << req.uid << version;
+        // the resolver waits for this load if it gets to the requirement before it's done
+        auto task = APPLICATION->metadataIndex()->loadVersion(req.uid, version, d->netmode);
+        d->prefetches.insert(key, task);
+        connect(task.get(), &Task::succeeded, this, [this, uid = req.uid, version] {
+            prefetchRequirements(APPLICATION->metadataIndex()->get(uid, version)->requiredSet());
+        });
+        task->start();
+    }
+}
+
 ComponentContainer ComponentUpdateTask::collectTreeLinked(const QString& uid)
 {
     ComponentContainer linked;
@@ -490,25 +564,7 @@ void ComponentUpdateTask::resolveDependencies(bool checkOnly)
             } else {
                 // version needs to be decided
                 qCDebug(instanceProfileResolveC) << "Adding" << add.uid << "at position" << add.indexOfFirstDependee;
-                // ############################################################################################################
-                // HACK HACK HACK HACK FIXME: this is a placeholder for deciding what version to use. For now, it is hardcoded.
-                if (!add.suggests.isEmpty()) {
-                    component->m_version = add.suggests;
-                } else {
-                    if (add.uid == "org.lwjgl") {
-                        component->m_version = "2.9.1";
-                    } else if (add.uid == "org.lwjgl3") {
-                        component->m_version = "3.1.2";
-                    } else if (add.uid == "net.fabricmc.intermediary" || add.uid == "org.quiltmc.hashed") {
-                        auto minecraft = std::find_if(components.begin(), components.end(),
-                                                      [](ComponentPtr& cmp) { return cmp->getID() == "net.minecraft"; });
-                        if (minecraft != components.end()) {
-                            component->m_version = (*minecraft)->getVersion();
-                        }
-                    }
-                }
-                // HACK HACK HACK HACK FIXME: this is a placeholder for deciding what version to use. For now, it is hardcoded.
-                // ############################################################################################################
+                component->m_version = versionForRequirement(add, components);
             }
             component->m_dependencyOnly = true;
             // FIXME: this should not work directly with the component list
@@ -726,6 +782,7 @@ void ComponentUpdateTask::remoteLoadSucceeded(size_t taskIndex)
         auto component = d->m_profile->getComponent(taskSlot.PackProfileIndex);
         component->m_loaded = true;
         component->updateCachedData();
+        prefetchRequirements(component->m_cachedRequires);
     }
     checkIfAllFinished();
 }
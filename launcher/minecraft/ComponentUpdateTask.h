@@ -1,5 +1,6 @@
 #pragma once
 
+#include "meta/JsonFormat.h"
 #include "minecraft/Component.h"
 #include "net/Mode.h"
 #include "tasks/Task.h"
@@ -27,6 +28,8 @@ class ComponentUpdateTask : public Task {
     void resolveDependencies(bool checkOnly);
     void performUpdateActions();
     void finalizeComponents();
+    /// starts loading requirements which aren't in the profile yet, along with whatever they require in turn
+    void prefetchRequirements(const Meta::RequireSet& reqs);
 
     void remoteLoadSucceeded(size_t index);
     void remoteLoadFailed(size_t index, const QString& msg);
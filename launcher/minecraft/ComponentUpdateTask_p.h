@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QElapsedTimer>
+#include <QHash>
 #include <QList>
 #include <QString>
 #include <cstddef>
@@ -26,4 +28,9 @@ struct ComponentUpdateTaskData {
     size_t remoteTasksInProgress = 0;
     ComponentUpdateTask::Mode mode;
     Net::Mode netmode;
+    // loads of requirements that will probably be added to the profile, started before it gets to them, by "uid:version"
+    QHash<QString, Task::Ptr> prefetches;
+    // for tracing how long resolution took, and how many rounds of loading it needed
+    QElapsedTimer timer;
+    int rounds = 0;
 };
@@ -53,6 +53,7 @@ void LaunchProfile::clear()
     m_jarMods.clear();
     m_mainJar.reset();
     m_problemSeverity = ProblemSeverity::None;
+    m_libraryFiles.invalidate();
 }
 
 static void applyString(const QString& from, QString& to)
@@ -122,6 +123,7 @@ void LaunchProfile::applyTweakers(const QStringList& tweakers)
 void LaunchProfile::applyJarMods(const QList<LibraryPtr>& jarMods)
 {
     this->m_jarMods.append(jarMods);
+    m_libraryFiles.invalidate();
 }
 
 static int findLibraryByName(QList<LibraryPtr>* haystack, const GradleSpecifier& needle)
@@ -176,6 +178,7 @@ void LaunchProfile::applyLibrary(LibraryPtr library, const RuntimeContext& runti
     if (!library->isActive(runtimeContext)) {
         return;
     }
+    m_libraryFiles.invalidate();
 
     QList<LibraryPtr>* list = &m_libraries;
     if (library->isNative()) {
@@ -236,6 +239,7 @@ void LaunchProfile::applyMainJar(LibraryPtr jar)
 {
     if (jar) {
         m_mainJar = jar;
+        m_libraryFiles.invalidate();
     }
 }
 
@@ -351,6 +355,15 @@ void LaunchProfile::getLibraryFiles(const RuntimeContext& runtimeContext,
                                     const QString& overridePath,
                                     const QString& tempPath) const
 {
+    // this gets asked for several times while launching, and working out all the paths isn't free
+    QMutexLocker locker(&m_libraryFiles.lock);
+    if (m_libraryFiles.valid && m_libraryFiles.runtimeContext == runtimeContext && m_libraryFiles.overridePath == overridePath &&
+        m_libraryFiles.tempPath == tempPath) {
+        jars = m_libraryFiles.jars;
+        nativeJars = m_libraryFiles.nativeJars;
+        return;
+    }
+
     QStringList native32, native64;
     jars.clear();
     nativeJars.clear();
@@ -375,4 +388,11 @@ void LaunchProfile::getLibraryFiles(const RuntimeContext& runtimeContext,
     } else if (runtimeContext.javaArchitecture == "64") {
         nativeJars.append(native64);
     }
+
+    m_libraryFiles.valid = true;
+    m_libraryFiles.runtimeContext = runtimeContext;
+    m_libraryFiles.overridePath = overridePath;
+    m_libraryFiles.tempPath = tempPath;
+    m_libraryFiles.jars = jars;
+    m_libraryFiles.nativeJars = nativeJars;
 }
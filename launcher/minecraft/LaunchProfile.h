@@ -35,6 +35,7 @@
 
 #pragma once
 #include <ProblemProvider.h>
+#include <QMutex>
 #include <QString>
 #include "Agent.h"
 #include "Library.h"
@@ -155,4 +156,29 @@ class LaunchProfile : public ProblemProvider {
     QString m_compatibleJavaName;
 
     ProblemSeverity m_problemSeverity = ProblemSeverity::None;
+
+    /// what getLibraryFiles() found last. It's left behind when the profile is copied, as copies get more patches applied.
+    struct LibraryFilesCache {
+        LibraryFilesCache() = default;
+        LibraryFilesCache(const LibraryFilesCache&) {}
+        LibraryFilesCache& operator=(const LibraryFilesCache&)
+        {
+            invalidate();
+            return *this;
+        }
+        void invalidate()
+        {
+            QMutexLocker locker(&lock);
+            valid = false;
+        }
+
+        QMutex lock;
+        bool valid = false;
+        RuntimeContext runtimeContext;
+        QString overridePath;
+        QString tempPath;
+        QStringList jars;
+        QStringList nativeJars;
+    };
+    mutable LibraryFilesCache m_libraryFiles;
 };
@@ -0,0 +1,338 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LevelDatReader.h"
+
+#include <QDebug>
+#include <QtEndian>
+
+#include <cstring>
+
+#include "GZip.h"
+
+namespace {
+
+enum TagType : uint8_t {
+    End = 0,
+    Byte = 1,
+    Short = 2,
+    Int = 3,
+    Long = 4,
+    Float = 5,
+    Double = 6,
+    ByteArray = 7,
+    String = 8,
+    List = 9,
+    Compound = 10,
+    IntArray = 11,
+    LongArray = 12,
+};
+
+// Deeper than anything the game writes, but keeps broken or malicious files from blowing the stack
+constexpr int s_max_depth = 512;
+
+/** Exact-size reads over the decompressed data, where running short means the file is broken. */
+class NbtInput {
+   public:
+    explicit NbtInput(QIODevice& device) : m_device(device) {}
+
+    bool read(void* dest, size_t size)
+    {
+        auto out = static_cast<char*>(dest);
+        while (size > 0) {
+            auto count = m_device.read(out, static_cast<qint64>(size));
+            if (count <= 0)
+                return false;
+            out += count;
+            size -= static_cast<size_t>(count);
+        }
+        return true;
+    }
+
+    bool skip(uint64_t size)
+    {
+        while (size > 0) {
+            auto count = m_device.skip(static_cast<qint64>(size));
+            if (count <= 0)
+                return false;
+            size -= static_cast<uint64_t>(count);
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool readBigEndian(T& value)
+    {
+        uchar bytes[sizeof(T)];
+        if (!read(bytes, sizeof(T)))
+            return false;
+        value = qFromBigEndian<T>(bytes);
+        return true;
+    }
+
+   private:
+    QIODevice& m_device;
+};
+
+/** Walks the NBT tree, only decoding the tags that end up in LevelDatInfo. */
+class LevelDatWalker {
+   public:
+    explicit LevelDatWalker(NbtInput& stream) : m_stream(stream) {}
+
+    bool readRoot(LevelDatInfo& info)
+    {
+        uint8_t type;
+        if (!m_stream.read(&type, 1) || type != Compound || !skipName())
+            return false;
+
+        // Only 'Data' matters at the root, and we can stop right after it
+        while (true) {
+            if (!m_stream.read(&type, 1))
+                return false;
+            if (type == End)
+                return false;
+
+            char name[16];
+            bool matches;
+            if (!readName(name, sizeof(name), matches))
+                return false;
+
+            if (matches && type == Compound && std::strcmp(name, "Data") == 0)
+                return readData(info);
+            if (!skipPayload(type, 1))
+                return false;
+        }
+    }
+
+   private:
+    bool readData(LevelDatInfo& info)
+    {
+        while (true) {
+            uint8_t type;
+            if (!m_stream.read(&type, 1))
+                return false;
+            if (type == End)
+                return true;
+
+            char name[32];
+            bool matches;
+            if (!readName(name, sizeof(name), matches))
+                return false;
+
+            if (matches) {
+                if (type == String && std::strcmp(name, "LevelName") == 0) {
+                    QString value;
+                    if (!readString(value))
+                        return false;
+                    info.levelName = value;
+                    continue;
+                }
+                if (type == Long && std::strcmp(name, "LastPlayed") == 0) {
+                    int64_t value;
+                    if (!m_stream.readBigEndian(value))
+                        return false;
+                    info.lastPlayed = value;
+                    continue;
+                }
+                if (type == Int && std::strcmp(name, "GameType") == 0) {
+                    int32_t value;
+                    if (!m_stream.readBigEndian(value))
+                        return false;
+                    info.gameType = value;
+                    continue;
+                }
+                if (type == Long && std::strcmp(name, "RandomSeed") == 0) {
+                    int64_t value;
+                    if (!m_stream.readBigEndian(value))
+                        return false;
+                    info.randomSeed = value;
+                    continue;
+                }
+                if (type == Compound && std::strcmp(name, "WorldGenSettings") == 0) {
+                    if (!readWorldGenSettings(info))
+                        return false;
+                    continue;
+                }
+            }
+
+            if (!skipPayload(type, 2))
+                return false;
+        }
+    }
+
+    bool readWorldGenSettings(LevelDatInfo& info)
+    {
+        while (true) {
+            uint8_t type;
+            if (!m_stream.read(&type, 1))
+                return false;
+            if (type == End)
+                return true;
+
+            char name[8];
+            bool matches;
+            if (!readName(name, sizeof(name), matches))
+                return false;
+
+            if (matches && type == Long && std::strcmp(name, "seed") == 0) {
+                int64_t value;
+                if (!m_stream.readBigEndian(value))
+                    return false;
+                info.worldGenSeed = value;
+                continue;
+            }
+
+            if (!skipPayload(type, 3))
+                return false;
+        }
+    }
+
+    /** Reads a tag name into 'buffer' if it fits, otherwise skips it, since none of the names we look for are that long. */
+    bool readName(char* buffer, size_t size, bool& fits)
+    {
+        uint16_t length;
+        if (!m_stream.readBigEndian(length))
+            return false;
+
+        fits = length < size;
+        if (!fits)
+            return m_stream.skip(length);
+
+        buffer[length] = '\0';
+        return m_stream.read(buffer, length);
+    }
+
+    bool skipName()
+    {
+        uint16_t length;
+        return m_stream.readBigEndian(length) && m_stream.skip(length);
+    }
+
+    bool readString(QString& value)
+    {
+        uint16_t length;
+        if (!m_stream.readBigEndian(length))
+            return false;
+
+        QByteArray bytes(length, Qt::Uninitialized);
+        if (!m_stream.read(bytes.data(), length))
+            return false;
+        value = QString::fromUtf8(bytes);
+        return true;
+    }
+
+    static int fixedPayloadSize(uint8_t type)
+    {
+        switch (type) {
+            case Byte:
+                return 1;
+            case Short:
+                return 2;
+            case Int:
+            case Float:
+                return 4;
+            case Long:
+            case Double:
+                return 8;
+            default:
+                return -1;
+        }
+    }
+
+    bool skipArray(int element_size)
+    {
+        int32_t length;
+        if (!m_stream.readBigEndian(length) || length < 0)
+            return false;
+        return m_stream.skip(static_cast<uint64_t>(length) * element_size);
+    }
+
+    bool skipPayload(uint8_t type, int depth)
+    {
+        if (depth > s_max_depth)
+            return false;
+
+        if (auto size = fixedPayloadSize(type); size > 0)
+            return m_stream.skip(size);
+
+        switch (type) {
+            case ByteArray:
+                return skipArray(1);
+            case IntArray:
+                return skipArray(4);
+            case LongArray:
+                return skipArray(8);
+            case String:
+                return skipName();
+            case List: {
+                uint8_t element_type;
+                int32_t length;
+                if (!m_stream.read(&element_type, 1) || !m_stream.readBigEndian(length))
+                    return false;
+                if (length <= 0)
+                    return true;
+
+                if (auto size = fixedPayloadSize(element_type); size > 0)
+                    return m_stream.skip(static_cast<uint64_t>(length) * size);
+                for (int32_t i = 0; i < length; i++)
+                    if (!skipPayload(element_type, depth + 1))
+                        return false;
+                return true;
+            }
+            case Compound: {
+                while (true) {
+                    uint8_t child_type;
+                    if (!m_stream.read(&child_type, 1))
+                        return false;
+                    if (child_type == End)
+                        return true;
+                    if (!skipName() || !skipPayload(child_type, depth + 1))
+                        return false;
+                }
+            }
+            default:
+                return false;
+        }
+    }
+
+    NbtInput& m_stream;
+};
+
+}  // namespace
+
+namespace LevelDatReader {
+
+std::optional<LevelDatInfo> read(QIODevice& device)
+{
+    // Buffered, so the many tiny reads the walker does come out of the device's buffer rather than zlib
+    GZipReader gzip(&device);
+    if (!gzip.open(QIODevice::ReadOnly)) {
+        qWarning() << "Unable to read level.dat:" << gzip.errorString();
+        return {};
+    }
+    NbtInput stream(gzip);
+    LevelDatWalker walker(stream);
+
+    LevelDatInfo info;
+    if (!walker.readRoot(info)) {
+        qWarning() << "Unable to parse level.dat";
+        return {};
+    }
+    return info;
+}
+
+}  // namespace LevelDatReader
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QIODevice>
+#include <QString>
+
+#include <cstdint>
+#include <optional>
+
+/** The few bits of a level.dat the launcher shows. Each one is empty if it wasn't in the file. */
+struct LevelDatInfo {
+    std::optional<QString> levelName;
+    std::optional<int64_t> lastPlayed;
+    std::optional<int> gameType;
+    std::optional<int64_t> worldGenSeed;  // Data.WorldGenSettings.seed, 1.16+
+    std::optional<int64_t> randomSeed;    // Data.RandomSeed, before 1.16
+};
+
+namespace LevelDatReader {
+
+/** Reads the gzipped level.dat from 'device' as it gets decompressed, keeping only the fields in LevelDatInfo.
+ *
+ *  Everything else, like the registries modded worlds embed in there, is skipped over without being stored, and
+ *  reading stops as soon as the 'Data' compound is done. Returns nothing if the file isn't a valid level.dat.
+ */
+std::optional<LevelDatInfo> read(QIODevice& device);
+
+}  // namespace LevelDatReader
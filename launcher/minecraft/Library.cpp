@@ -241,6 +241,8 @@ bool Library::isActive(const RuntimeContext& runtimeContext) const
     bool result = true;
     if (m_rules.empty()) {
         result = true;
+    } else if (m_compiledRules.isValid()) {
+        result = m_compiledRules.allows(CompiledRules::contextMask(runtimeContext));
     } else {
         RuleAction ruleResult = Disallow;
         for (auto rule : m_rules) {
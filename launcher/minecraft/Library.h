@@ -73,6 +73,7 @@ class Library {
         newlib->m_extractExcludes = base->m_extractExcludes;
         newlib->m_nativeClassifiers = base->m_nativeClassifiers;
         newlib->m_rules = base->m_rules;
+        newlib->m_compiledRules = base->m_compiledRules;
         newlib->m_storagePrefix = base->m_storagePrefix;
         newlib->m_mojangDownloads = base->m_mojangDownloads;
         newlib->m_filename = base->m_filename;
@@ -129,7 +130,11 @@ class Library {
     void setHint(const QString& hint) { m_hint = hint; }
 
     /// Set the load rules
-    void setRules(QList<std::shared_ptr<Rule>> rules) { m_rules = rules; }
+    void setRules(QList<std::shared_ptr<Rule>> rules)
+    {
+        m_rules = rules;
+        m_compiledRules = CompiledRules(m_rules);
+    }
 
     /// Returns true if the library should be loaded (or extracted, in case of natives)
     bool isActive(const RuntimeContext& runtimeContext) const;
@@ -205,6 +210,9 @@ class Library {
     /// rules associated with the library
     QList<std::shared_ptr<Rule>> m_rules;
 
+    /// the same rules, in the form isActive() checks
+    CompiledRules m_compiledRules;
+
     /// MOJANG: container with Mojang style download info
     MojangLibraryDownloadInfo::Ptr m_mojangDownloads;
 };
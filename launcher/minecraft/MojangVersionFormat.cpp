@@ -319,7 +319,7 @@ LibraryPtr MojangVersionFormat::libraryFromJson(ProblemContainer& problems, cons
     }
     if (libObj.contains("rules")) {
         out->applyRules = true;
-        out->m_rules = rulesFromJsonV4(libObj);
+        out->setRules(rulesFromJsonV4(libObj));
     }
     if (libObj.contains("downloads")) {
         out->m_mojangDownloads = libDownloadInfoFromJson(libObj);
@@ -43,6 +43,7 @@
 #include <QDebug>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QJsonArray>
 #include <QJsonDocument>
 #include <QSaveFile>
@@ -146,16 +147,21 @@ static ComponentPtr componentFromJsonV1(PackProfile* parent, const QString& comp
     return component;
 }
 
-// Save the given component container data to a file
-static bool savePackProfile(const QString& filename, const ComponentContainer& container)
+static QJsonArray componentsToJsonV1(const ComponentContainer& container)
 {
-    QJsonObject obj;
-    obj.insert("formatVersion", currentComponentsFileVersion);
     QJsonArray orderArray;
     for (auto component : container) {
         orderArray.append(componentToJsonV1(component));
     }
-    obj.insert("components", orderArray);
+    return orderArray;
+}
+
+// Save the given component list to a file
+static bool savePackProfile(const QString& filename, const QJsonArray& components)
+{
+    QJsonObject obj;
+    obj.insert("formatVersion", currentComponentsFileVersion);
+    obj.insert("components", components);
     QSaveFile outFile(filename);
     if (!outFile.open(QFile::WriteOnly)) {
         qCCritical(instanceProfileC) << "Couldn't open" << outFile.fileName() << "for writing:" << outFile.errorString();
@@ -168,15 +174,13 @@ static bool savePackProfile(const QString& filename, const ComponentContainer& c
     }
     if (!outFile.commit()) {
         qCCritical(instanceProfileC) << "Couldn't save" << outFile.fileName() << "because:" << outFile.errorString();
+        return false;
     }
     return true;
 }
 
-// Read the given file into component containers
-static bool loadPackProfile(PackProfile* parent,
-                            const QString& filename,
-                            const QString& componentJsonPattern,
-                            ComponentContainer& container)
+// Read the component list from the given file
+static bool readPackProfile(const QString& filename, QJsonArray& components)
 {
     QFile componentsFile(filename);
     if (!componentsFile.exists()) {
@@ -198,7 +202,6 @@ static bool loadPackProfile(PackProfile* parent,
         return false;
     }
 
-    // and then read it and process it if all above is true.
     try {
         auto obj = Json::requireObject(doc);
         // check order file version.
@@ -206,19 +209,49 @@ static bool loadPackProfile(PackProfile* parent,
         if (version != currentComponentsFileVersion) {
             throw JSONValidationError(QObject::tr("Invalid component file version, expected %1").arg(currentComponentsFileVersion));
         }
-        auto orderArray = Json::requireArray(obj.value("components"));
-        for (auto item : orderArray) {
+        components = Json::requireArray(obj.value("components"));
+    } catch ([[maybe_unused]] const JSONValidationError& err) {
+        qCCritical(instanceProfileC) << "Couldn't parse" << componentsFile.fileName() << ": bad file format";
+        return false;
+    }
+    return true;
+}
+
+// Turn the component list read from a file into component containers
+static bool loadPackProfile(PackProfile* parent,
+                            const QString& filename,
+                            const QString& componentJsonPattern,
+                            const QJsonArray& components,
+                            ComponentContainer& container)
+{
+    try {
+        for (auto item : components) {
             auto comp_obj = Json::requireObject(item, "Component must be an object.");
             container.append(componentFromJsonV1(parent, componentJsonPattern, comp_obj));
         }
     } catch ([[maybe_unused]] const JSONValidationError& err) {
-        qCCritical(instanceProfileC) << "Couldn't parse" << componentsFile.fileName() << ": bad file format";
+        qCCritical(instanceProfileC) << "Couldn't parse" << filename << ": bad file format";
         container.clear();
         return false;
     }
     return true;
 }
 
+// Whether the file is still in the state it was left in when the persisted component list was read or written
+static bool isPersistedFileCurrent(const PersistedComponents& persisted, const QString& filename)
+{
+    const QFileInfo info(filename);
+    return persisted.size >= 0 && info.exists() && info.size() == persisted.size && info.lastModified() == persisted.modified;
+}
+
+static void rememberPersisted(PersistedComponents& persisted, const QString& filename, const QJsonArray& components)
+{
+    const QFileInfo info(filename);
+    persisted.size = info.exists() ? info.size() : -1;
+    persisted.modified = info.lastModified();
+    persisted.components = components;
+}
+
 // END: component file format
 
 // BEGIN: save/load logic
@@ -277,19 +310,40 @@ QString PackProfile::patchFilePathForUid(const QString& uid) const
 
 void PackProfile::save_internal()
 {
-    qDebug() << d->m_instance->name() << "|" << "Component list save performed now";
     auto filename = componentsFilePath();
-    savePackProfile(filename, d->components);
+    auto components = componentsToJsonV1(d->components);
     d->dirty = false;
+    // most changes that schedule a save don't change anything that's saved, like the cached data of components after a resolve
+    if (components == d->m_persisted.components && isPersistedFileCurrent(d->m_persisted, filename)) {
+        qDebug() << d->m_instance->name() << "|" << "Component list is unchanged, not saving it";
+        return;
+    }
+    qDebug() << d->m_instance->name() << "|" << "Component list save performed now";
+    if (savePackProfile(filename, components)) {
+        rememberPersisted(d->m_persisted, filename, components);
+    } else {
+        d->m_persisted = {};
+    }
 }
 
 bool PackProfile::load()
 {
     auto filename = componentsFilePath();
 
+    // the file only needs reading again if something else changed it since it was last read or written
+    QJsonArray components;
+    bool read = true;
+    if (isPersistedFileCurrent(d->m_persisted, filename)) {
+        components = d->m_persisted.components;
+    } else if ((read = readPackProfile(filename, components))) {
+        rememberPersisted(d->m_persisted, filename, components);
+    } else {
+        d->m_persisted = {};
+    }
+
     // load the new component list and swap it with the current one...
     ComponentContainer newComponents;
-    if (!loadPackProfile(this, filename, patchesPattern(), newComponents)) {
+    if (!read || !loadPackProfile(this, filename, patchesPattern(), components, newComponents)) {
         qCritical() << d->m_instance->name() << "|" << "Failed to load the component config";
         return false;
     } else {
@@ -946,11 +1000,30 @@ std::shared_ptr<LaunchProfile> PackProfile::getProfile() const
 {
     if (!d->m_profile) {
         try {
+            auto& applied = d->m_appliedComponents;
+            const auto runtimeContext = d->m_instance->runtimeContext();
             auto profile = std::make_shared<LaunchProfile>();
-            for (auto file : d->components) {
+
+            // each component applies on top of the ones before, so everything up to the first change can be reused
+            int index = 0;
+            for (; index < d->components.size() && index < applied.size(); index++) {
+                const auto& component = d->components.at(index);
+                const auto& step = applied.at(index);
+                if (step.uid != component->getID() || step.file != component->getVersionFile() || step.enabled != component->isEnabled() ||
+                    step.severity != component->getProblemSeverity() || step.runtimeContext != runtimeContext)
+                    break;
+                profile = step.profile;
+            }
+            applied.erase(applied.begin() + index, applied.end());
+
+            for (; index < d->components.size(); index++) {
+                const auto& file = d->components.at(index);
                 qCDebug(instanceProfileC) << d->m_instance->name() << "|" << "Applying" << file->getID()
                                           << (file->getProblemSeverity() == ProblemSeverity::Error ? "ERROR" : "GOOD");
-                file->applyTo(profile.get());
+                auto next = std::make_shared<LaunchProfile>(*profile);
+                file->applyTo(next.get());
+                applied.append({ file->getID(), file->getVersionFile(), file->isEnabled(), file->getProblemSeverity(), runtimeContext, next });
+                profile = next;
             }
             d->m_profile = profile;
         } catch (const Exception& error) {
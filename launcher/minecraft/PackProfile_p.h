@@ -1,26 +1,51 @@
 #pragma once
 
+#include <QDateTime>
+#include <QJsonArray>
 #include <QList>
 #include <QMap>
 #include <QTimer>
 #include "Component.h"
+#include "RuntimeContext.h"
 #include "tasks/Task.h"
 
 class MinecraftInstance;
 using ComponentContainer = QList<ComponentPtr>;
 using ComponentIndex = QMap<QString, ComponentPtr>;
 
+// What applying a component gave, and everything that went into it
+struct AppliedComponent {
+    QString uid;
+    std::shared_ptr<VersionFile> file;
+    bool enabled;
+    ProblemSeverity severity;
+    RuntimeContext runtimeContext;
+
+    // the launch profile with this and all the components before it applied
+    std::shared_ptr<LaunchProfile> profile;
+};
+
+// The component list as it was last read from or written to mmc-pack.json, and the state the file was left in
+struct PersistedComponents {
+    qint64 size = -1;
+    QDateTime modified;
+    QJsonArray components;
+};
+
 struct PackProfileData {
     // the instance this belongs to
     MinecraftInstance* m_instance;
 
     // the launch profile (volatile, temporary thing created on demand)
     std::shared_ptr<LaunchProfile> m_profile;
+    // the steps of building the last launch profile, so the next one only applies the components from the first changed one on
+    QList<AppliedComponent> m_appliedComponents;
 
     // persistent list of components and related machinery
     ComponentContainer components;
     ComponentIndex componentIndex;
     bool dirty = false;
+    PersistedComponents m_persisted;
     QTimer m_saveTimer;
     Task::Ptr m_updateTask;
     bool loaded = false;
@@ -39,8 +39,11 @@
 #include "minecraft/OneSixVersionFormat.h"
 #include "minecraft/VersionFilterData.h"
 
+#include <QDateTime>
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonDocument>
+#include <QMutex>
 #include <QRegularExpression>
 #include <QSaveFile>
 
@@ -109,7 +112,7 @@ static VersionFilePtr guardedParseJson(const QJsonDocument& doc, const QString&
     }
 }
 
-VersionFilePtr parseJsonFile(const QFileInfo& fileInfo, const bool requireOrder)
+static VersionFilePtr parseJsonFileUncached(const QFileInfo& fileInfo, const bool requireOrder)
 {
     QFile file(fileInfo.absoluteFilePath());
     if (!file.open(QFile::ReadOnly)) {
@@ -140,6 +143,39 @@ VersionFilePtr parseJsonFile(const QFileInfo& fileInfo, const bool requireOrder)
     return guardedParseJson(doc, fileInfo.completeBaseName(), fileInfo.absoluteFilePath(), requireOrder);
 }
 
+namespace {
+struct ParsedFile {
+    qint64 size;
+    QDateTime modified;
+    bool requireOrder;
+    VersionFilePtr file;
+};
+QMutex s_parsedFilesLock;
+QHash<QString, ParsedFile> s_parsedFiles;
+}  // namespace
+
+VersionFilePtr parseJsonFile(const QFileInfo& fileInfo, const bool requireOrder)
+{
+    // the passed info might have been taken before the file changed
+    const QFileInfo current(fileInfo.absoluteFilePath());
+    const auto path = current.absoluteFilePath();
+    {
+        QMutexLocker locker(&s_parsedFilesLock);
+        auto cached = s_parsedFiles.constFind(path);
+        if (cached != s_parsedFiles.constEnd() && cached->size == current.size() && cached->modified == current.lastModified() &&
+            cached->requireOrder == requireOrder)
+            return cached->file;
+    }
+
+    auto file = parseJsonFileUncached(current, requireOrder);
+    // failures are cheap to find again, and might have been caused by something that gets fixed
+    if (file->getProblemSeverity() != ProblemSeverity::Error) {
+        QMutexLocker locker(&s_parsedFilesLock);
+        s_parsedFiles.insert(path, { current.size(), current.lastModified(), requireOrder, file });
+    }
+    return file;
+}
+
 bool saveJsonFile(const QJsonDocument& doc, const QString& filename)
 {
     auto data = doc.toJson();
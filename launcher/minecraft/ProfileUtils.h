@@ -46,7 +46,9 @@ bool readOverrideOrders(QString path, PatchOrder& order);
 /// Write a OneSix format order file
 bool writeOverrideOrders(QString path, const PatchOrder& order);
 
-/// Parse a version file in JSON format
+/// Parse a version file in JSON format.
+/// Files that haven't changed since they were last parsed are returned from memory, shared with everyone who parsed them,
+/// so copy them before making changes.
 VersionFilePtr parseJsonFile(const QFileInfo& fileInfo, bool requireOrder);
 
 /// Save a JSON file (in any format)
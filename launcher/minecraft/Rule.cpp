@@ -33,8 +33,10 @@
  *      limitations under the License.
  */
 
+#include <QHash>
 #include <QJsonArray>
 #include <QJsonObject>
+#include <QMutex>
 
 #include "Rule.h"
 
@@ -107,3 +109,74 @@ QJsonObject OsRule::toJson()
     ruleObj.insert("os", osObj);
     return ruleObj;
 }
+
+namespace {
+// every OS name used by a rule gets a bit, in the order they show up. Mojang only ever used a handful.
+QMutex s_systemsLock;
+QHash<QString, int> s_systemBits;
+QStringList s_systems;
+constexpr int s_max_systems = 64;
+}  // namespace
+
+CompiledRules::CompiledRules(const QList<std::shared_ptr<Rule>>& rules)
+{
+    QMutexLocker locker(&s_systemsLock);
+    for (auto& rule : rules) {
+        if (auto osRule = std::dynamic_pointer_cast<OsRule>(rule)) {
+            int bit = s_systemBits.value(osRule->system(), -1);
+            if (bit < 0) {
+                if (s_systems.size() >= s_max_systems) {
+                    m_valid = false;
+                    m_steps.clear();
+                    return;
+                }
+                bit = s_systems.size();
+                s_systems.append(osRule->system());
+                s_systemBits.insert(osRule->system(), bit);
+            }
+            m_steps.append({ rule->result(), quint64(1) << bit });
+        } else if (std::dynamic_pointer_cast<ImplicitRule>(rule)) {
+            m_steps.append({ rule->result(), 0 });
+        } else {
+            m_valid = false;
+            m_steps.clear();
+            return;
+        }
+    }
+}
+
+bool CompiledRules::allows(quint64 contextMask) const
+{
+    if (m_steps.isEmpty())
+        return true;
+    // the last rule that applies decides, and nothing applying means no
+    for (auto step = m_steps.crbegin(); step != m_steps.crend(); ++step) {
+        if (!step->bit || (contextMask & step->bit))
+            return step->action == Allow;
+    }
+    return false;
+}
+
+quint64 CompiledRules::contextMask(const RuntimeContext& runtimeContext)
+{
+    // libraries get checked one after another against the same context, so each thread remembers the last one
+    thread_local struct {
+        QString system;
+        QString javaRealArchitecture;
+        int systems = -1;
+        quint64 mask = 0;
+    } s_last;
+
+    QMutexLocker locker(&s_systemsLock);
+    if (s_last.systems == s_systems.size() && s_last.system == runtimeContext.system &&
+        s_last.javaRealArchitecture == runtimeContext.javaRealArchitecture)
+        return s_last.mask;
+
+    quint64 mask = 0;
+    for (int bit = 0; bit < s_systems.size(); bit++) {
+        if (runtimeContext.classifierMatches(s_systems.at(bit)))
+            mask |= quint64(1) << bit;
+    }
+    s_last = { runtimeContext.system, runtimeContext.javaRealArchitecture, static_cast<int>(s_systems.size()), mask };
+    return mask;
+}
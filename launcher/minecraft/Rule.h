@@ -57,6 +57,7 @@ class Rule {
     Rule(RuleAction result) : m_result(result) {}
     virtual ~Rule() {}
     virtual QJsonObject toJson() = 0;
+    RuleAction result() const { return m_result; }
     RuleAction apply(const Library* parent, const RuntimeContext& runtimeContext)
     {
         if (applies(parent, runtimeContext))
@@ -79,6 +80,7 @@ class OsRule : public Rule {
 
    public:
     virtual QJsonObject toJson();
+    const QString& system() const { return m_system; }
     static std::shared_ptr<OsRule> create(RuleAction result, QString system, QString version_regexp)
     {
         return std::shared_ptr<OsRule>(new OsRule(result, system, version_regexp));
@@ -94,3 +96,32 @@ class ImplicitRule : public Rule {
     virtual QJsonObject toJson();
     static std::shared_ptr<ImplicitRule> create(RuleAction result) { return std::shared_ptr<ImplicitRule>(new ImplicitRule(result)); }
 };
+
+/**
+ * The rules of a library, reduced to the OS names they check.
+ * Each OS name any library checks gets a bit, and a runtime context gets matched against all of them at once with
+ * contextMask(), so checking a library afterwards doesn't compare any strings.
+ */
+class CompiledRules {
+   public:
+    CompiledRules() = default;
+    explicit CompiledRules(const QList<std::shared_ptr<Rule>>& rules);
+
+    /// False if the rules have something that can't be compiled, and have to be applied one by one
+    bool isValid() const { return m_valid; }
+
+    /// Whether the rules allow a library, given the contextMask() of the runtime context
+    bool allows(quint64 contextMask) const;
+
+    /// Which of the OS names used by rules match 'runtimeContext'
+    static quint64 contextMask(const RuntimeContext& runtimeContext);
+
+   private:
+    struct Step {
+        RuleAction action;
+        // the bit of the OS name, or 0 for rules that always apply
+        quint64 bit;
+    };
+    QList<Step> m_steps;
+    bool m_valid = true;
+};
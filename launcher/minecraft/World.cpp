@@ -57,6 +57,7 @@
 
 #include "FileSystem.h"
 #include "PSaveFile.h"
+#include "minecraft/LevelDatReader.h"
 
 using std::nullopt;
 using std::optional;
@@ -187,11 +188,8 @@ bool putLevelDatDataToFS(const QFileInfo& file, QByteArray& data)
     if (!f.open(QIODevice::WriteOnly)) {
         return false;
     }
-    QByteArray compressed;
-    if (!GZip::zip(data, compressed)) {
-        return false;
-    }
-    if (f.write(compressed) != compressed.size()) {
+    GZipWriter gzip(&f);
+    if (!gzip.open(QIODevice::WriteOnly) || gzip.write(data) != data.size() || !gzip.finish()) {
         f.cancelWriting();
         return false;
     }
@@ -214,16 +212,16 @@ int64_t calculateWorldSize(const QFileInfo& file)
     return -1;
 }
 
-World::World(const QFileInfo& file)
+World::World(const QFileInfo& file, bool calculate_size)
 {
-    repath(file);
+    repath(file, calculate_size);
 }
 
-void World::repath(const QFileInfo& file)
+void World::repath(const QFileInfo& file, bool calculate_size)
 {
     m_containerFile = file;
     m_folderName = file.fileName();
-    m_size = calculateWorldSize(file);
+    m_size = calculate_size ? calculateWorldSize(file) : -1;
     if (file.isFile() && file.suffix() == "zip") {
         m_iconFile = QString();
         readFromZip(file);
@@ -250,13 +248,18 @@ bool World::resetIcon()
 
 void World::readFromFS(const QFileInfo& file)
 {
-    auto bytes = getLevelDatDataFromFS(file);
-    if (bytes.isEmpty()) {
+    auto fullFilePath = getLevelDatFromFS(file);
+    if (fullFilePath.isNull()) {
+        is_valid = false;
+        return;
+    }
+    QFile f(fullFilePath);
+    if (!f.open(QIODevice::ReadOnly)) {
         is_valid = false;
         return;
     }
-    loadFromLevelDat(bytes);
     levelDatTime = file.lastModified();
+    loadFromLevelDat(f);
 }
 
 void World::readFromZip(const QFileInfo& file)
@@ -289,7 +292,7 @@ void World::readFromZip(const QFileInfo& file)
     if (!is_valid) {
         return;
     }
-    loadFromLevelDat(zippedFile.readAll());
+    loadFromLevelDat(zippedFile);
     zippedFile.close();
 }
 
@@ -357,122 +360,28 @@ bool World::rename(const QString& newName)
     return true;
 }
 
-namespace {
-
-optional<QString> read_string(nbt::value& parent, const char* name)
+void World::loadFromLevelDat(QIODevice& device)
 {
-    try {
-        auto& namedValue = parent.at(name);
-        if (namedValue.get_type() != nbt::tag_type::String) {
-            return nullopt;
-        }
-        auto& tag_str = namedValue.as<nbt::tag_string>();
-        return QString::fromStdString(tag_str.get());
-    } catch ([[maybe_unused]] const std::out_of_range& e) {
-        // fallback for old world formats
-        qWarning() << "String NBT tag" << name << "could not be found.";
-        return nullopt;
-    } catch ([[maybe_unused]] const std::bad_cast& e) {
-        // type mismatch
-        qWarning() << "NBT tag" << name << "could not be converted to string.";
-        return nullopt;
-    }
-}
-
-optional<int64_t> read_long(nbt::value& parent, const char* name)
-{
-    try {
-        auto& namedValue = parent.at(name);
-        if (namedValue.get_type() != nbt::tag_type::Long) {
-            return nullopt;
-        }
-        auto& tag_str = namedValue.as<nbt::tag_long>();
-        return tag_str.get();
-    } catch ([[maybe_unused]] const std::out_of_range& e) {
-        // fallback for old world formats
-        qWarning() << "Long NBT tag" << name << "could not be found.";
-        return nullopt;
-    } catch ([[maybe_unused]] const std::bad_cast& e) {
-        // type mismatch
-        qWarning() << "NBT tag" << name << "could not be converted to long.";
-        return nullopt;
-    }
-}
-
-optional<int> read_int(nbt::value& parent, const char* name)
-{
-    try {
-        auto& namedValue = parent.at(name);
-        if (namedValue.get_type() != nbt::tag_type::Int) {
-            return nullopt;
-        }
-        auto& tag_str = namedValue.as<nbt::tag_int>();
-        return tag_str.get();
-    } catch ([[maybe_unused]] const std::out_of_range& e) {
-        // fallback for old world formats
-        qWarning() << "Int NBT tag" << name << "could not be found.";
-        return nullopt;
-    } catch ([[maybe_unused]] const std::bad_cast& e) {
-        // type mismatch
-        qWarning() << "NBT tag" << name << "could not be converted to int.";
-        return nullopt;
-    }
-}
-
-GameType read_gametype(nbt::value& parent, const char* name)
-{
-    return GameType(read_int(parent, name));
-}
-
-}  // namespace
-
-void World::loadFromLevelDat(QByteArray data)
-{
-    auto levelData = parseLevelDat(data);
+    auto levelData = LevelDatReader::read(device);
     if (!levelData) {
+        qWarning() << "Unable to read NBT tags from" << m_folderName;
         is_valid = false;
         return;
     }
+    is_valid = true;
 
-    nbt::value* valPtr = nullptr;
-    try {
-        valPtr = &levelData->at("Data");
-    } catch (const std::out_of_range& e) {
-        qWarning() << "Unable to read NBT tags from " << m_folderName << ":" << e.what();
-        is_valid = false;
-        return;
-    }
-    nbt::value& val = *valPtr;
-
-    is_valid = val.get_type() == nbt::tag_type::Compound;
-    if (!is_valid)
-        return;
-
-    auto name = read_string(val, "LevelName");
-    m_actualName = name ? *name : m_folderName;
+    m_actualName = levelData->levelName.value_or(m_folderName);
+    m_lastPlayed = levelData->lastPlayed ? QDateTime::fromMSecsSinceEpoch(*levelData->lastPlayed) : levelDatTime;
+    m_gameType = GameType(levelData->gameType);
 
-    auto timestamp = read_long(val, "LastPlayed");
-    m_lastPlayed = timestamp ? QDateTime::fromMSecsSinceEpoch(*timestamp) : levelDatTime;
-
-    m_gameType = read_gametype(val, "GameType");
-
-    optional<int64_t> randomSeed;
-    try {
-        auto& WorldGen_val = val.at("WorldGenSettings");
-        randomSeed = read_long(WorldGen_val, "seed");
-    } catch (const std::out_of_range&) {
-    }
-    if (!randomSeed) {
-        randomSeed = read_long(val, "RandomSeed");
-    }
-    m_randomSeed = randomSeed ? *randomSeed : 0;
+    auto randomSeed = levelData->worldGenSeed ? levelData->worldGenSeed : levelData->randomSeed;
+    m_randomSeed = randomSeed.value_or(0);
 
     qDebug() << "World Name:" << m_actualName;
     qDebug() << "Last Played:" << m_lastPlayed.toString();
     if (randomSeed) {
         qDebug() << "Seed:" << *randomSeed;
     }
-    qDebug() << "Size:" << m_size;
     qDebug() << "GameType:" << m_gameType.toLogString();
 }
 
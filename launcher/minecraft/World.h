@@ -16,6 +16,7 @@
 #pragma once
 #include <QDateTime>
 #include <QFileInfo>
+#include <QIODevice>
 #include <optional>
 
 struct GameType {
@@ -29,13 +30,18 @@ struct GameType {
     std::optional<int> original;
 };
 
+/** Sums up the size of every file in the world, which can take a while for big worlds. */
+int64_t calculateWorldSize(const QFileInfo& file);
+
 class World {
    public:
-    World(const QFileInfo& file);
+    /** Reads the world at 'file'. Without 'calculate_size', its size is left unknown (-1) until set with setBytes(). */
+    World(const QFileInfo& file, bool calculate_size = true);
     QString folderName() const { return m_folderName; }
     QString name() const { return m_actualName; }
     QString iconFile() const { return m_iconFile; }
     int64_t bytes() const { return m_size; }
+    void setBytes(int64_t size) { m_size = size; }
     QDateTime lastPlayed() const { return m_lastPlayed; }
     GameType gameType() const { return m_gameType; }
     int64_t seed() const { return m_randomSeed; }
@@ -47,7 +53,7 @@ class World {
     // replace this world with a copy of the other
     bool replace(World& with);
     // change the world's filesystem path (used by world lists for *MAGIC* purposes)
-    void repath(const QFileInfo& file);
+    void repath(const QFileInfo& file, bool calculate_size = true);
     // remove the icon file, if any
     bool resetIcon();
 
@@ -75,7 +81,7 @@ class World {
    private:
     void readFromZip(const QFileInfo& file);
     void readFromFS(const QFileInfo& file);
-    void loadFromLevelDat(QByteArray data);
+    void loadFromLevelDat(QIODevice& device);
 
    protected:
     QFileInfo m_containerFile;
@@ -85,7 +91,7 @@ class World {
     QString m_iconFile;
     QDateTime levelDatTime;
     QDateTime m_lastPlayed;
-    int64_t m_size;
+    int64_t m_size = -1;
     int64_t m_randomSeed = 0;
     GameType m_gameType;
     bool is_valid = false;
@@ -38,12 +38,20 @@
 #include <FileSystem.h>
 #include <QDebug>
 #include <QFileSystemWatcher>
+#include <QFutureWatcher>
+#include <QJsonObject>
 #include <QMimeData>
 #include <QString>
+#include <QThreadPool>
 #include <QUrl>
 #include <QUuid>
 #include <Qt>
+#include <QtConcurrent>
+
+#include <utility>
+
 #include "Application.h"
+#include "Json.h"
 
 WorldList::WorldList(const QString& dir, BaseInstance* instance) : QAbstractListModel(), m_instance(instance), m_dir(dir)
 {
@@ -53,6 +61,13 @@ WorldList::WorldList(const QString& dir, BaseInstance* instance) : QAbstractList
     m_watcher = new QFileSystemWatcher(this);
     is_watching = false;
     connect(m_watcher, &QFileSystemWatcher::directoryChanged, this, &WorldList::directoryChanged);
+
+    // A single save touches a bunch of files in the world, so wait for things to settle before looking at it again
+    m_changed_worlds_timer.setSingleShot(true);
+    m_changed_worlds_timer.setInterval(1000);
+    connect(&m_changed_worlds_timer, &QTimer::timeout, this, &WorldList::reloadChangedWorlds);
+
+    loadSizeCache();
 }
 
 void WorldList::startWatching()
@@ -63,6 +78,9 @@ void WorldList::startWatching()
     update();
     is_watching = m_watcher->addPath(m_dir.absolutePath());
     if (is_watching) {
+        // Also watch the worlds themselves, so we notice when the game saves them
+        for (auto const& world : worlds)
+            m_watcher->addPath(world.container().absoluteFilePath());
         qDebug() << "Started watching " << m_dir.absolutePath();
     } else {
         qDebug() << "Failed to start watching " << m_dir.absolutePath();
@@ -74,6 +92,13 @@ void WorldList::stopWatching()
     if (!is_watching) {
         return;
     }
+    auto world_dirs = m_watcher->directories();
+    world_dirs.removeAll(m_dir.absolutePath());
+    if (!world_dirs.isEmpty())
+        m_watcher->removePaths(world_dirs);
+    m_changed_worlds_timer.stop();
+    m_changed_worlds.clear();
+
     is_watching = !m_watcher->removePath(m_dir.absolutePath());
     if (!is_watching) {
         qDebug() << "Stopped watching " << m_dir.absolutePath();
@@ -87,28 +112,219 @@ bool WorldList::update()
     if (!isValid())
         return false;
 
-    QList<World> newWorlds;
     m_dir.refresh();
-    auto folderContents = m_dir.entryInfoList();
-    // if there are any untracked files...
-    for (QFileInfo entry : folderContents) {
+    QSet<QString> present;
+    for (auto const& entry : m_dir.entryInfoList()) {
         if (!entry.isDir())
             continue;
+        auto folder = entry.fileName();
+        present.insert(folder);
+
+        // Worlds that weren't played since we last read them can stay as they are
+        auto level_dat_modified = QFileInfo(QDir(entry.absoluteFilePath()), "level.dat").lastModified().toMSecsSinceEpoch();
+        auto cached = m_size_cache.constFind(folder);
+        if (rowOf(folder) >= 0 && cached != m_size_cache.constEnd() && cached->level_dat_modified == level_dat_modified)
+            continue;
+
+        loadWorld(entry);
+    }
+
+    for (int row = static_cast<int>(worlds.size()) - 1; row >= 0; row--) {
+        if (present.contains(worlds.at(row).folderName()))
+            continue;
+        beginRemoveRows(QModelIndex(), row, row);
+        worlds.removeAt(row);
+        endRemoveRows();
+    }
 
-        World w(entry);
-        if (w.isValid()) {
-            newWorlds.append(w);
+    for (auto it = m_verified_sizes.begin(); it != m_verified_sizes.end();) {
+        if (present.contains(*it))
+            ++it;
+        else
+            it = m_verified_sizes.erase(it);
+    }
+    for (auto it = m_size_cache.begin(); it != m_size_cache.end();) {
+        if (present.contains(it.key())) {
+            ++it;
+        } else {
+            it = m_size_cache.erase(it);
+            m_size_cache_dirty = true;
         }
     }
-    beginResetModel();
-    worlds.swap(newWorlds);
-    endResetModel();
+
+    if (m_pending_loads.isEmpty()) {
+        saveSizeCache();
+        emit updateFinished();
+    }
     return true;
 }
 
+int WorldList::rowOf(const QString& folder) const
+{
+    for (int row = 0; row < worlds.size(); row++)
+        if (worlds.at(row).folderName() == folder)
+            return row;
+    return -1;
+}
+
+void WorldList::loadWorld(const QFileInfo& entry, bool force_size)
+{
+    auto folder = entry.fileName();
+    auto ticket = m_next_ticket++;
+    m_pending_loads.insert(folder, ticket);
+
+    auto level_dat_modified = QFileInfo(QDir(entry.absoluteFilePath()), "level.dat").lastModified().toMSecsSinceEpoch();
+    auto cached = force_size ? SizeCacheEntry{} : m_size_cache.value(folder);
+    bool cache_hit = cached.size >= 0 && cached.level_dat_modified == level_dat_modified;
+
+    auto future = QtConcurrent::run(QThreadPool::globalInstance(), [entry, cache_hit, cached] {
+        auto world = std::make_shared<World>(entry, false);
+        if (world->isValid())
+            world->setBytes(cache_hit ? cached.size : calculateWorldSize(entry));
+        return world;
+    });
+
+    // The watcher goes away with us, so results for a destroyed list are simply dropped
+    auto watcher = new QFutureWatcher<std::shared_ptr<World>>(this);
+    connect(watcher, &QFutureWatcherBase::finished, this, [this, watcher, folder, ticket, level_dat_modified, cache_hit] {
+        watcher->deleteLater();
+        worldLoaded(folder, ticket, level_dat_modified, cache_hit, watcher->result());
+    });
+    watcher->setFuture(future);
+}
+
+void WorldList::worldLoaded(const QString& folder,
+                            int ticket,
+                            qint64 level_dat_modified,
+                            bool size_from_cache,
+                            std::shared_ptr<World> world)
+{
+    auto pending = m_pending_loads.constFind(folder);
+    if (pending == m_pending_loads.constEnd() || *pending != ticket)
+        return;
+    m_pending_loads.erase(pending);
+
+    auto row = rowOf(folder);
+    // It could've been deleted while we were reading it
+    if (!world->isValid() || !world->container().exists()) {
+        if (row >= 0) {
+            beginRemoveRows(QModelIndex(), row, row);
+            worlds.removeAt(row);
+            endRemoveRows();
+        }
+    } else {
+        m_size_cache.insert(folder, { level_dat_modified, world->bytes() });
+        m_size_cache_dirty = true;
+        if (!size_from_cache)
+            m_verified_sizes.insert(folder);
+        else if (!m_verified_sizes.contains(folder))
+            m_unverified_sizes.append(world->container());
+
+        if (row >= 0) {
+            worlds[row] = *world;
+            emit dataChanged(index(row, 0), index(row, columnCount(QModelIndex()) - 1));
+        } else {
+            beginInsertRows(QModelIndex(), static_cast<int>(worlds.size()), static_cast<int>(worlds.size()));
+            worlds.append(*world);
+            endInsertRows();
+
+            if (is_watching)
+                m_watcher->addPath(world->container().absoluteFilePath());
+        }
+    }
+
+    if (m_pending_loads.isEmpty()) {
+        saveSizeCache();
+        emit updateFinished();
+
+        // The cached sizes are already showing, so checking them doesn't hold anything up
+        auto unverified = std::exchange(m_unverified_sizes, {});
+        for (const auto& entry : unverified)
+            loadWorld(entry, true);
+    }
+}
+
 void WorldList::directoryChanged(QString path)
 {
-    update();
+    if (QDir(path) == m_dir) {
+        update();
+        return;
+    }
+
+    m_changed_worlds.insert(path);
+    m_changed_worlds_timer.start();
+}
+
+void WorldList::reloadChangedWorlds()
+{
+    for (auto const& path : m_changed_worlds) {
+        QFileInfo entry(path);
+        // Removed ones get handled when the parent folder changes
+        if (entry.isDir() && rowOf(entry.fileName()) >= 0)
+            loadWorld(entry, true);
+    }
+    m_changed_worlds.clear();
+}
+
+QString WorldList::sizeCachePath(const QString& instance_id)
+{
+    if (!APPLICATION_DYN)
+        return {};
+    return FS::PathCombine(APPLICATION->dataRoot(), "cache", "worlds", instance_id + ".json");
+}
+
+void WorldList::loadSizeCache()
+{
+    if (!m_instance)
+        return;
+    auto path = sizeCachePath(m_instance->id());
+    if (path.isEmpty() || !QFileInfo::exists(path))
+        return;
+
+    try {
+        auto root = Json::requireObject(Json::requireDocument(path, "World size cache"));
+        auto sizes = Json::ensureObject(root, "worlds");
+        for (auto it = sizes.constBegin(); it != sizes.constEnd(); ++it) {
+            auto entry = Json::requireObject(it.value());
+            m_size_cache.insert(it.key(), { static_cast<qint64>(Json::requireDouble(entry, "levelDatModified")),
+                                            static_cast<qint64>(Json::requireDouble(entry, "size")) });
+        }
+    } catch (const Exception& e) {
+        qWarning() << "Could not read the world size cache, starting from scratch:" << e.cause();
+        m_size_cache.clear();
+    }
+}
+
+void WorldList::saveSizeCache()
+{
+    if (!m_size_cache_dirty)
+        return;
+    m_size_cache_dirty = false;
+
+    if (!m_instance)
+        return;
+    auto path = sizeCachePath(m_instance->id());
+    if (path.isEmpty())
+        return;
+
+    QJsonObject sizes;
+    for (auto it = m_size_cache.constBegin(); it != m_size_cache.constEnd(); ++it) {
+        QJsonObject entry;
+        entry.insert("levelDatModified", static_cast<double>(it->level_dat_modified));
+        entry.insert("size", static_cast<double>(it->size));
+        sizes.insert(it.key(), entry);
+    }
+
+    QJsonObject root;
+    root.insert("formatVersion", 1);
+    root.insert("worlds", sizes);
+
+    try {
+        FS::ensureFilePathExists(path);
+        Json::write(root, path);
+    } catch (const Exception& e) {
+        qWarning() << "Could not write the world size cache:" << e.cause();
+    }
 }
 
 bool WorldList::isValid()
@@ -193,6 +409,8 @@ QVariant WorldList::data(const QModelIndex& index, int role) const
                     return world.lastPlayed();
 
                 case SizeColumn:
+                    if (world.bytes() < 0)
+                        return QVariant();
                     return locale.formattedDataSize(world.bytes());
 
                 case InfoColumn:
@@ -17,9 +17,12 @@
 
 #include <QAbstractListModel>
 #include <QDir>
+#include <QHash>
 #include <QList>
 #include <QMimeData>
+#include <QSet>
 #include <QString>
+#include <QTimer>
 #include "BaseInstance.h"
 #include "minecraft/World.h"
 
@@ -44,7 +47,11 @@ class WorldList : public QAbstractListModel {
     bool empty() const { return size() == 0; }
     World& operator[](size_t index) { return worlds[index]; }
 
-    /// Reloads the mod list and returns true if the list changed.
+    /// Where the world sizes of the instance with the given ID are cached, or an empty string if they aren't.
+    static QString sizeCachePath(const QString& instance_id);
+
+    /// Reloads the world list. Worlds are read in the background, and show up as they get loaded, until updateFinished() is emitted.
+    /// Returns false if the folder can't be read.
     virtual bool update();
 
     /// Install a world from location
@@ -89,6 +96,24 @@ class WorldList : public QAbstractListModel {
 
    signals:
     void changed();
+    void updateFinished();
+
+   private:
+    /// Reads the world at 'entry' in the background. 'force_size' skips the size cache, for when we know the files changed.
+    void loadWorld(const QFileInfo& entry, bool force_size = false);
+    void worldLoaded(const QString& folder, int ticket, qint64 level_dat_modified, bool size_from_cache, std::shared_ptr<World> world);
+    void reloadChangedWorlds();
+    int rowOf(const QString& folder) const;
+
+    /// World sizes are kept on disk between sessions, along with the level.dat modification time they were computed for.
+    /// Minecraft rewrites level.dat every time it saves, so a matching time means the size is most likely still good. Other
+    /// tools don't always touch it, so a size taken from here is still computed again in the background, once per session.
+    struct SizeCacheEntry {
+        qint64 level_dat_modified = -1;
+        qint64 size = -1;
+    };
+    void loadSizeCache();
+    void saveSizeCache();
 
    protected:
     BaseInstance* m_instance;
@@ -96,4 +121,17 @@ class WorldList : public QAbstractListModel {
     bool is_watching;
     QDir m_dir;
     QList<World> worlds;
+
+    QHash<QString, SizeCacheEntry> m_size_cache;
+    bool m_size_cache_dirty = false;
+    // Folders whose size was computed since the list was created, and worlds that only have a size from the cache so far
+    QSet<QString> m_verified_sizes;
+    QList<QFileInfo> m_unverified_sizes;
+
+    // Folder name -> ticket of the newest load for it, so older results coming in late get ignored
+    QHash<QString, int> m_pending_loads;
+    int m_next_ticket = 0;
+
+    QSet<QString> m_changed_worlds;
+    QTimer m_changed_worlds_timer;
 };
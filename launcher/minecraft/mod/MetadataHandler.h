@@ -65,6 +65,11 @@ inline auto get(const QDir& index_dir, QVariant& mod_id) -> ModStruct
     return Packwiz::V1::getIndexForMod(index_dir, mod_id);
 }
 
+inline auto getAll(const QDir& index_dir, bool use_cache = true) -> QList<ModStruct>
+{
+    return Packwiz::V1::getAllIndexes(index_dir, use_cache);
+}
+
 inline auto modSideToString(ModSide side) -> QString
 {
     return Packwiz::V1::sideToString(side);
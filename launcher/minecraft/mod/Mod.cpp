@@ -42,8 +42,8 @@
 #include <QRegularExpression>
 #include <QString>
 
-#include "MTPixmapCache.h"
 #include "MetadataHandler.h"
+#include "ResourceIconCache.h"
 #include "Resource.h"
 #include "Version.h"
 #include "minecraft/mod/ModDetails.h"
@@ -230,17 +230,10 @@ QPixmap Mod::setIcon(QImage new_image) const
 
     Q_ASSERT(!new_image.isNull());
 
-    if (m_packImageCacheKey.key.isValid())
-        PixmapCache::remove(m_packImageCacheKey.key);
-
-    // scale the image to avoid flooding the pixmapcache
-    auto pixmap =
-        QPixmap::fromImage(new_image.scaled({ 64, 64 }, Qt::AspectRatioMode::KeepAspectRatioByExpanding, Qt::SmoothTransformation));
-
-    m_packImageCacheKey.key = PixmapCache::insert(pixmap);
+    auto icon = ResourceIconCache::instance().insert(fileinfo(), new_image);
     m_packImageCacheKey.wasEverUsed = true;
     m_packImageCacheKey.wasReadAttempt = true;
-    return pixmap;
+    return QPixmap::fromImage(icon);
 }
 
 QPixmap Mod::icon(QSize size, Qt::AspectRatioMode mode) const
@@ -251,23 +244,25 @@ QPixmap Mod::icon(QSize size, Qt::AspectRatioMode mode) const
         return pixmap.scaled(size, mode, Qt::SmoothTransformation);
     };
 
-    QPixmap cached_image;
-    if (PixmapCache::find(m_packImageCacheKey.key, &cached_image)) {
-        return pixmap_transform(cached_image);
+    // Evicted icons come back from the disk cache here, without opening the jar again
+    auto cached_image = ResourceIconCache::instance().find(fileinfo());
+    if (!cached_image.isNull()) {
+        m_packImageCacheKey.wasEverUsed = true;
+        return pixmap_transform(QPixmap::fromImage(cached_image));
     }
 
     // No valid image we can get
     if ((!m_packImageCacheKey.wasEverUsed && m_packImageCacheKey.wasReadAttempt) || iconPath().isEmpty())
         return {};
 
-    if (m_packImageCacheKey.wasEverUsed) {
-        qDebug() << "Mod" << name() << "Had it's icon evicted from the cache. reloading...";
-        PixmapCache::markCacheMissByEviciton();
-    }
-    // Image got evicted from the cache or an attempt to load it has not been made. load it and retry.
+    if (m_packImageCacheKey.wasEverUsed)
+        qDebug() << "Mod" << name() << "Had it's icon removed from the cache. reloading...";
+
+    // Image got removed from the cache or an attempt to load it has not been made. load it and retry.
     m_packImageCacheKey.wasReadAttempt = true;
-    if (ModUtils::loadIconFile(*this, &cached_image)) {
-        return pixmap_transform(cached_image);
+    QPixmap loaded_image;
+    if (ModUtils::loadIconFile(*this, &loaded_image)) {
+        return pixmap_transform(loaded_image);
     }
     // Image failed to load
     return {};
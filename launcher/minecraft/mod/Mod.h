@@ -42,7 +42,6 @@
 #include <QList>
 #include <QMutex>
 #include <QPixmap>
-#include <QPixmapCache>
 
 #include <optional>
 
@@ -98,8 +97,8 @@ class Mod : public Resource {
 
     mutable QMutex m_data_lock;
 
+    // Whether the icon was ever put in the ResourceIconCache, and whether reading it from the mod was tried at all
     struct {
-        QPixmapCache::Key key;
         bool wasEverUsed = false;
         bool wasReadAttempt = false;
     } mutable m_packImageCacheKey;
@@ -17,6 +17,7 @@
 #include "FileSystem.h"
 
 #include "minecraft/mod/tasks/ResourceFolderLoadTask.h"
+#include "minecraft/mod/tasks/ResourceParseScheduler.h"
 
 #include "Json.h"
 #include "minecraft/mod/tasks/LocalResourceUpdateTask.h"
@@ -37,14 +38,16 @@ ResourceFolderModel::ResourceFolderModel(const QDir& dir, BaseInstance* instance
     m_dir.setSorting(QDir::Name | QDir::IgnoreCase | QDir::LocaleAware);
 
     connect(&m_watcher, &QFileSystemWatcher::directoryChanged, this, &ResourceFolderModel::directoryChanged);
-    connect(&m_helper_thread_task, &ConcurrentTask::finished, this, [this] { m_helper_thread_task.clear(); });
-    if (APPLICATION_DYN) {  // in tests the application macro doesn't work
-        m_helper_thread_task.setMaxConcurrent(APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
-    }
 }
 
 ResourceFolderModel::~ResourceFolderModel()
 {
+    // Nothing that is still queued should start after we're gone
+    auto& scheduler = ResourceParseScheduler::instance();
+    scheduler.cancel(this);
+    while (!scheduler.waitForOwner(this, 100))
+        QCoreApplication::processEvents();
+
     while (!QThreadPool::globalInstance()->waitForDone(100))
         QCoreApplication::processEvents();
 }
@@ -354,11 +357,55 @@ void ResourceFolderModel::resolveResource(Resource::Ptr res)
         },
         Qt::ConnectionType::QueuedConnection);
 
-    m_helper_thread_task.addTask(task);
+    ResourceParseScheduler::instance().schedule(this, task);
+}
+
+void ResourceFolderModel::prioritizeResources(const QModelIndexList& indexes)
+{
+    QSet<Task*> tasks;
+    for (auto const& idx : indexes) {
+        if (!validateIndex(idx))
+            continue;
+
+        auto const& resource = m_resources.at(idx.row());
+        if (!resource->isResolving())
+            continue;
 
-    if (!m_helper_thread_task.isRunning()) {
-        QThreadPool::globalInstance()->start(&m_helper_thread_task);
+        auto task = m_active_parse_tasks.constFind(resource->resolutionTicket());
+        if (task != m_active_parse_tasks.constEnd())
+            tasks.insert(task->get());
     }
+
+    ResourceParseScheduler::instance().prioritize(this, tasks);
+}
+
+void ResourceFolderModel::cancelParseTasks()
+{
+    // Running tasks are left alone: they are writing into their resource, so it can't be handed to a new task
+    // before they finish, and they are few anyway
+    auto dropped = ResourceParseScheduler::instance().cancel(this, false);
+    if (dropped.isEmpty())
+        return;
+    QSet<Task*> dropped_tasks;
+    for (auto& task : dropped)
+        dropped_tasks.insert(task.get());
+
+    // Forget about the resources whose tasks never started, so that they get resolved again by resumeParseTasks()
+    for (auto& resource : m_resources) {
+        if (!resource->isResolving())
+            continue;
+        auto task = m_active_parse_tasks.find(resource->resolutionTicket());
+        if (task != m_active_parse_tasks.end() && dropped_tasks.contains(task->get())) {
+            m_active_parse_tasks.erase(task);
+            resource->setResolving(false, resource->resolutionTicket());
+        }
+    }
+}
+
+void ResourceFolderModel::resumeParseTasks()
+{
+    for (auto& resource : m_resources)
+        resolveResource(resource);
 }
 
 void ResourceFolderModel::onUpdateSucceeded()
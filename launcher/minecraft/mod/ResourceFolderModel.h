@@ -115,6 +115,13 @@ class ResourceFolderModel : public QAbstractListModel {
     /** Creates a new parse task, if needed, for 'res' and start it.*/
     virtual void resolveResource(Resource::Ptr res);
 
+    /** Makes the pending parse tasks of the resources at 'indexes' run before the other ones, like for rows visible in a view. */
+    void prioritizeResources(const QModelIndexList& indexes);
+    /** Drops the pending parse tasks, i.e. when nothing is showing this model anymore. Running ones are left to finish. */
+    void cancelParseTasks();
+    /** Starts parsing the resources that were left unresolved by cancelParseTasks(). */
+    void resumeParseTasks();
+
     [[nodiscard]] qsizetype size() const { return m_resources.size(); }
     [[nodiscard]] bool empty() const { return size() == 0; }
 
@@ -261,7 +268,6 @@ class ResourceFolderModel : public QAbstractListModel {
     // Represents the relationship between a resource's internal ID and it's row position on the model.
     QMap<QString, int> m_resources_index;
 
-    ConcurrentTask m_helper_thread_task;
     QMap<int, Task::Ptr> m_active_parse_tasks;
     std::atomic<int> m_next_resolution_ticket = 0;
 };
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ResourceIconCache.h"
+
+#include <QBuffer>
+#include <QDateTime>
+#include <QImageReader>
+#include <QThreadPool>
+
+#include "Application.h"
+#include "FileSystem.h"
+
+// Room for a couple thousand icons at 64x64
+static constexpr int s_memory_budget_kib = 32 * 1024;
+
+static QImage scaleDown(const QImage& image)
+{
+    if (image.width() <= ResourceIconCache::s_icon_size && image.height() <= ResourceIconCache::s_icon_size)
+        return image;
+    return image.scaled({ ResourceIconCache::s_icon_size, ResourceIconCache::s_icon_size }, Qt::KeepAspectRatioByExpanding,
+                        Qt::SmoothTransformation);
+}
+
+ResourceIconCache& ResourceIconCache::instance()
+{
+    // in tests the application macro doesn't work, so keep it in memory only
+    static ResourceIconCache s_instance(APPLICATION_DYN ? FS::PathCombine(APPLICATION->dataRoot(), "cache", "resource_icons") : QString(),
+                                        s_memory_budget_kib);
+    return s_instance;
+}
+
+ResourceIconCache::ResourceIconCache(QString disk_dir, int memory_budget_kib)
+{
+    m_memory.setMaxCost(memory_budget_kib);
+    if (!disk_dir.isEmpty()) {
+        m_disk = std::make_shared<ThumbnailCache>(disk_dir, s_icon_size);
+        QThreadPool::globalInstance()->start([disk = m_disk] { disk->prune(); });
+    }
+}
+
+ResourceIconCache::~ResourceIconCache() = default;
+
+QString ResourceIconCache::memoryKey(const QFileInfo& file)
+{
+    return QString("%1:%2:%3").arg(file.absoluteFilePath()).arg(file.lastModified().toMSecsSinceEpoch()).arg(file.size());
+}
+
+QImage ResourceIconCache::decode(const QByteArray& data)
+{
+    QBuffer buffer;
+    buffer.setData(data);
+    buffer.open(QIODevice::ReadOnly);
+
+    QImageReader reader(&buffer);
+    auto size = reader.size();
+    if (size.isValid() && size.width() > s_icon_size && size.height() > s_icon_size)
+        reader.setScaledSize(size.scaled(s_icon_size, s_icon_size, Qt::KeepAspectRatioByExpanding));
+    return reader.read();
+}
+
+QImage ResourceIconCache::insert(const QFileInfo& file, const QImage& icon)
+{
+    auto scaled = scaleDown(icon);
+    auto cost = qMax(1, static_cast<int>(scaled.sizeInBytes() / 1024));
+    {
+        QMutexLocker locker(&m_lock);
+        m_memory.insert(memoryKey(file), new QImage(scaled), cost);
+    }
+
+    // Folders get parsed on every change, so only write out what isn't there already
+    if (m_disk && !m_disk->contains(file))
+        m_disk->store(file, scaled);
+    return scaled;
+}
+
+QImage ResourceIconCache::find(const QFileInfo& file)
+{
+    auto key = memoryKey(file);
+    {
+        QMutexLocker locker(&m_lock);
+        if (auto image = m_memory.object(key))
+            return *image;
+    }
+
+    if (!m_disk)
+        return {};
+
+    auto image = m_disk->load(file);
+    if (!image.isNull()) {
+        auto cost = qMax(1, static_cast<int>(image.sizeInBytes() / 1024));
+        QMutexLocker locker(&m_lock);
+        m_memory.insert(key, new QImage(image), cost);
+    }
+    return image;
+}
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QCache>
+#include <QFileInfo>
+#include <QImage>
+#include <QMutex>
+#include <QString>
+
+#include <memory>
+
+#include "screenshots/ThumbnailCache.h"
+
+/** Icons of mods and resource packs, downscaled to the size the views show them at.
+ *
+ *  Icons are kept in memory up to a budget. Every icon is also written to disk, so one that got evicted comes back
+ *  from there instead of from reopening the archive it came from. Entries are keyed by the resource's file, and
+ *  dropped once its size or modification time changes. Icons on disk get pruned like screenshot thumbnails do.
+ *  Thread-safe.
+ */
+class ResourceIconCache {
+   public:
+    // The largest any view shows these icons at
+    static constexpr int s_icon_size = 64;
+
+    static ResourceIconCache& instance();
+
+    /** 'disk_dir' can be empty to keep everything in memory only. */
+    ResourceIconCache(QString disk_dir, int memory_budget_kib);
+    ~ResourceIconCache();
+
+    /** Decodes an image straight to icon size, without holding it at full size first. Returns a null image on failure. */
+    static QImage decode(const QByteArray& data);
+
+    /** Stores 'icon' as the icon of 'file', scaled down if it's bigger than the icon size, and returns what got stored. */
+    QImage insert(const QFileInfo& file, const QImage& icon);
+
+    /** Returns the icon of 'file' from memory or disk, or a null image if neither has it. */
+    QImage find(const QFileInfo& file);
+
+   private:
+    static QString memoryKey(const QFileInfo& file);
+
+    QMutex m_lock;
+    QCache<QString, QImage> m_memory;
+    ThumbnailCache::Ptr m_disk;
+};
@@ -5,7 +5,6 @@
 #include <QImage>
 #include <QMutex>
 #include <QPixmap>
-#include <QPixmapCache>
 
 class Version;
 
@@ -59,13 +58,10 @@ class ResourcePack : public Resource {
      */
     QString m_description;
 
-    /** The resource pack's image file cache key, for access in the QPixmapCache global instance.
-     *
-     *  The 'was_ever_used' state simply identifies whether the key was never inserted on the cache (true),
-     *  so as to tell whether a cache entry is inexistent or if it was just evicted from the cache.
+    /** Whether the resource pack's image was ever put in the ResourceIconCache, so as to tell whether it has none,
+     *  or if it is gone from the cache and needs to be read from the pack again.
      */
     struct {
-        QPixmapCache::Key key;
         bool was_ever_used = false;
     } mutable m_pack_image_cache_key;
 };
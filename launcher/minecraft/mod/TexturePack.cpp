@@ -23,7 +23,7 @@
 #include <QMap>
 #include <QRegularExpression>
 
-#include "MTPixmapCache.h"
+#include "ResourceIconCache.h"
 
 #include "minecraft/mod/tasks/LocalTexturePackParseTask.h"
 
@@ -40,37 +40,31 @@ void TexturePack::setImage(QImage new_image) const
 
     Q_ASSERT(!new_image.isNull());
 
-    if (m_pack_image_cache_key.key.isValid())
-        PixmapCache::remove(m_pack_image_cache_key.key);
-
-    // scale the image to avoid flooding the pixmapcache
-    auto pixmap =
-        QPixmap::fromImage(new_image.scaled({ 64, 64 }, Qt::AspectRatioMode::KeepAspectRatioByExpanding, Qt::SmoothTransformation));
-
-    m_pack_image_cache_key.key = PixmapCache::insert(pixmap);
+    ResourceIconCache::instance().insert(fileinfo(), new_image);
     m_pack_image_cache_key.was_ever_used = true;
 }
 
 QPixmap TexturePack::image(QSize size, Qt::AspectRatioMode mode) const
 {
-    QPixmap cached_image;
-    if (PixmapCache::find(m_pack_image_cache_key.key, &cached_image)) {
-        if (size.isNull())
-            return cached_image;
-        return cached_image.scaled(size, mode, Qt::SmoothTransformation);
-    }
+    auto cached_image = ResourceIconCache::instance().find(fileinfo());
 
     // No valid image we can get
-    if (!m_pack_image_cache_key.was_ever_used) {
+    if (cached_image.isNull() && !m_pack_image_cache_key.was_ever_used)
         return {};
-    } else {
-        qDebug() << "Texture Pack" << name() << "Had it's image evicted from the cache. reloading...";
-        PixmapCache::markCacheMissByEviciton();
+
+    // Not on disk either, so it must have been cleaned up. Re-process it and retry.
+    if (cached_image.isNull()) {
+        qDebug() << "Texture Pack" << name() << "Had it's image removed from the cache. reloading...";
+        TexturePackUtils::processPackPNG(*this);
+        cached_image = ResourceIconCache::instance().find(fileinfo());
+        if (cached_image.isNull())
+            return {};
     }
 
-    // Imaged got evicted from the cache. Re-process it and retry.
-    TexturePackUtils::processPackPNG(*this);
-    return image(size);
+    auto pixmap = QPixmap::fromImage(cached_image);
+    if (size.isNull())
+        return pixmap;
+    return pixmap.scaled(size, mode, Qt::SmoothTransformation);
 }
 
 bool TexturePack::valid() const
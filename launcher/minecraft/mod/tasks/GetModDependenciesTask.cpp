@@ -18,9 +18,11 @@
 
 #include "GetModDependenciesTask.h"
 
+#include <QDateTime>
 #include <QDebug>
 #include <algorithm>
 #include <memory>
+#include "Application.h"
 #include "Json.h"
 #include "QObjectPtr.h"
 #include "minecraft/PackProfile.h"
@@ -29,11 +31,35 @@
 #include "modplatform/ResourceAPI.h"
 #include "modplatform/flame/FlameAPI.h"
 #include "modplatform/modrinth/ModrinthAPI.h"
-#include "tasks/SequentialTask.h"
 #include "ui/pages/modplatform/ModModel.h"
 #include "ui/pages/modplatform/flame/FlameResourceModels.h"
 #include "ui/pages/modplatform/modrinth/ModrinthResourceModels.h"
 
+namespace {
+// The same dependencies come up for many mods, and again each time mods get installed or updated, so what was resolved
+// is remembered for a while
+constexpr qint64 s_memo_ttl_secs = 10 * 60;
+
+struct MemoisedVersion {
+    ModPlatform::IndexedVersion version;
+    QDateTime resolved;
+};
+struct MemoisedProject {
+    ModPlatform::IndexedPack pack;
+    QDateTime loaded;
+};
+
+// Keyed by provider, dependency, game version and loaders
+QHash<QString, MemoisedVersion> s_memoised_versions;
+// Keyed by provider and project ID
+QHash<QString, MemoisedProject> s_memoised_projects;
+
+bool isFresh(const QDateTime& time)
+{
+    return time.secsTo(QDateTime::currentDateTimeUtc()) <= s_memo_ttl_secs;
+}
+}  // namespace
+
 static Version mcVersion(BaseInstance* inst)
 {
     return static_cast<MinecraftInstance*>(inst)->getPackProfile()->getComponent("net.minecraft")->getVersion();
@@ -55,7 +81,7 @@ static bool checkDependencies(std::shared_ptr<GetModDependenciesTask::PackDepend
 GetModDependenciesTask::GetModDependenciesTask(BaseInstance* instance,
                                                ModFolderModel* folder,
                                                QList<std::shared_ptr<PackDependency>> selected)
-    : SequentialTask(tr("Get dependencies"))
+    : ConcurrentTask(tr("Get dependencies"), APPLICATION->settings()->get("NumberOfConcurrentDownloads").toInt())
     , m_selected(selected)
     , m_flame_provider{ ModPlatform::ResourceProvider::FLAME, std::make_shared<ResourceDownload::FlameModModel>(*instance),
                         std::make_shared<FlameAPI>() }
@@ -74,12 +100,22 @@ GetModDependenciesTask::GetModDependenciesTask(BaseInstance* instance,
 
 void GetModDependenciesTask::prepare()
 {
+    // Dependencies of all the selected mods make up the first level, so they get looked up together
+    QMap<ModPlatform::ResourceProvider, QList<ModPlatform::Dependency>> first_level;
     for (auto sel : m_selected) {
-        if (checkDependencies(sel, m_version, m_loaderType))
-            for (auto dep : getDependenciesForVersion(sel->version, sel->pack->provider)) {
-                addTask(prepareDependencyTask(dep, sel->pack->provider, 20));
-            }
+        if (!checkDependencies(sel, m_version, m_loaderType))
+            continue;
+        auto& deps = first_level[sel->pack->provider];
+        for (auto dep : getDependenciesForVersion(sel->version, sel->pack->provider)) {
+            if (std::none_of(deps.begin(), deps.end(),
+                             [&dep](const ModPlatform::Dependency& i) { return i.addonId == dep.addonId && i.version == dep.version; }))
+                deps.append(dep);
+        }
     }
+
+    for (auto it = first_level.constBegin(); it != first_level.constEnd(); ++it)
+        if (!it.value().isEmpty())
+            addDependencyTasks(it.value(), it.key(), 20);
 }
 
 ModPlatform::Dependency GetModDependenciesTask::getOverride(const ModPlatform::Dependency& dep,
@@ -142,53 +178,127 @@ QList<ModPlatform::Dependency> GetModDependenciesTask::getDependenciesForVersion
     return c_dependencies;
 }
 
-Task::Ptr GetModDependenciesTask::getProjectInfoTask(std::shared_ptr<PackDependency> pDep)
+QString GetModDependenciesTask::versionKey(const ModPlatform::Dependency& dep, ModPlatform::ResourceProvider providerName) const
+{
+    return QString("%1:%2:%3:%4:%5")
+        .arg(ModPlatform::ProviderCapabilities::name(providerName))
+        .arg(dep.addonId.toString(), dep.version, m_version.toString())
+        .arg(static_cast<int>(m_loaderType));
+}
+
+static QString projectKey(const QVariant& addonId, ModPlatform::ResourceProvider providerName)
+{
+    return QString("%1:%2").arg(ModPlatform::ProviderCapabilities::name(providerName), addonId.toString());
+}
+
+bool GetModDependenciesTask::loadMemoisedProject(std::shared_ptr<PackDependency> pDep)
+{
+    auto memo = s_memoised_projects.constFind(projectKey(pDep->pack->addonId, pDep->pack->provider));
+    if (memo == s_memoised_projects.constEnd() || !isFresh(memo->loaded))
+        return false;
+
+    auto versions = pDep->pack->versions;
+    auto versions_loaded = pDep->pack->versionsLoaded;
+    *pDep->pack = memo->pack;
+    pDep->pack->versions = versions;
+    pDep->pack->versionsLoaded = versions_loaded;
+    return true;
+}
+
+void GetModDependenciesTask::addDependencyTasks(const QList<ModPlatform::Dependency>& deps,
+                                                ModPlatform::ResourceProvider providerName,
+                                                int level)
+{
+    QList<std::shared_ptr<PackDependency>> missing_info;
+    QList<std::pair<std::shared_ptr<PackDependency>, ModPlatform::IndexedVersion>> memoised;
+
+    for (auto& dep : deps) {
+        auto pDep = std::make_shared<PackDependency>();
+        pDep->dependency = dep;
+        pDep->pack = std::make_shared<ModPlatform::IndexedPack>();
+        pDep->pack->addonId = dep.addonId;
+        pDep->pack->provider = providerName;
+        m_pack_dependencies.append(pDep);
+
+        if (!dep.addonId.toString().isEmpty() && !loadMemoisedProject(pDep))
+            missing_info.append(pDep);
+
+        if (auto memo = s_memoised_versions.constFind(versionKey(dep, providerName));
+            memo != s_memoised_versions.constEnd() && isFresh(memo->resolved)) {
+            memoised.append({ pDep, memo->version });
+        } else if (auto task = getDependencyVersionTask(pDep, providerName, level); task) {
+            addTask(task);
+        }
+    }
+
+    // All of a level's projects are fetched in one request
+    if (!missing_info.isEmpty())
+        addTask(getProjectInfoTask(missing_info, providerName));
+
+    // Only once the whole level is in the list, so the next level gets deduplicated against it
+    for (auto& [pDep, version] : memoised) {
+        pDep->version = version;
+        dependencyVersionLoaded(pDep, providerName, level);
+    }
+}
+
+Task::Ptr GetModDependenciesTask::getProjectInfoTask(QList<std::shared_ptr<PackDependency>> pDeps, ModPlatform::ResourceProvider providerName)
 {
-    auto provider = pDep->pack->provider == m_flame_provider.name ? m_flame_provider : m_modrinth_provider;
+    auto provider = providerName == m_flame_provider.name ? m_flame_provider : m_modrinth_provider;
+    QStringList addonIds;
+    for (auto& pDep : pDeps)
+        addonIds.append(pDep->pack->addonId.toString());
+
     auto responseInfo = std::make_shared<QByteArray>();
-    auto info = provider.api->getProject(pDep->pack->addonId.toString(), responseInfo);
-    QObject::connect(info.get(), &NetJob::succeeded, [this, responseInfo, provider, pDep] {
+    auto info = provider.api->getProjects(addonIds, responseInfo);
+    QObject::connect(info.get(), &Task::succeeded, [this, responseInfo, provider, pDeps] {
         QJsonParseError parse_error{};
         QJsonDocument doc = QJsonDocument::fromJson(*responseInfo, &parse_error);
         if (parse_error.error != QJsonParseError::NoError) {
-            removePack(pDep->pack->addonId);
+            for (auto& pDep : pDeps)
+                removePack(pDep->pack->addonId);
             qWarning() << "Error while parsing JSON response for mod info at " << parse_error.offset
                        << " reason: " << parse_error.errorString();
             qDebug() << *responseInfo;
             return;
         }
-        try {
-            auto obj = provider.name == ModPlatform::ResourceProvider::FLAME ? Json::requireObject(Json::requireObject(doc), "data")
-                                                                             : Json::requireObject(doc);
-            provider.mod->loadIndexedPack(*pDep->pack, obj);
-        } catch (const JSONValidationError& e) {
-            removePack(pDep->pack->addonId);
-            qDebug() << doc;
-            qWarning() << "Error while reading mod info: " << e.cause();
+
+        QHash<QString, QJsonObject> projects;
+        for (auto project : doc.isObject() ? Json::ensureArray(doc.object(), "data") : doc.array()) {
+            auto obj = project.toObject();
+            projects.insert(obj.value("id").toVariant().toString(), obj);
+        }
+
+        for (auto& pDep : pDeps) {
+            auto obj = projects.value(pDep->pack->addonId.toString());
+            if (obj.isEmpty()) {
+                removePack(pDep->pack->addonId);
+                qWarning() << "Mod info missing from the response for" << pDep->pack->addonId.toString();
+                continue;
+            }
+            try {
+                provider.mod->loadIndexedPack(*pDep->pack, obj);
+
+                auto memo = *pDep->pack;
+                memo.versions.clear();
+                memo.versionsLoaded = false;
+                s_memoised_projects.insert(projectKey(memo.addonId, provider.name), { memo, QDateTime::currentDateTimeUtc() });
+            } catch (const JSONValidationError& e) {
+                removePack(pDep->pack->addonId);
+                qDebug() << obj;
+                qWarning() << "Error while reading mod info: " << e.cause();
+            }
         }
     });
     return info;
 }
 
-Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Dependency& dep,
-                                                        const ModPlatform::ResourceProvider providerName,
-                                                        int level)
+Task::Ptr GetModDependenciesTask::getDependencyVersionTask(std::shared_ptr<PackDependency> pDep,
+                                                           const ModPlatform::ResourceProvider providerName,
+                                                           int level)
 {
-    auto pDep = std::make_shared<PackDependency>();
-    pDep->dependency = dep;
-    pDep->pack = std::make_shared<ModPlatform::IndexedPack>();
-    pDep->pack->addonId = dep.addonId;
-    pDep->pack->provider = providerName;
-
-    m_pack_dependencies.append(pDep);
     auto provider = providerName == m_flame_provider.name ? m_flame_provider : m_modrinth_provider;
-
-    auto tasks = makeShared<SequentialTask>(
-        QString("DependencyInfo: %1").arg(dep.addonId.toString().isEmpty() ? dep.version : dep.addonId.toString()));
-
-    if (!dep.addonId.toString().isEmpty()) {
-        tasks->addTask(getProjectInfoTask(pDep));
-    }
+    auto dep = pDep->dependency;
 
     ResourceAPI::DependencySearchArgs args = { dep, m_version, m_loaderType };
     ResourceAPI::DependencySearchCallbacks callbacks;
@@ -211,7 +321,7 @@ Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Depen
                                              [dep, provider](auto o) { return o.provider == provider.name && dep.addonId == o.quilt; });
                     if (over != overide.cend()) {
                         removePack(dep.addonId);
-                        addTask(prepareDependencyTask({ over->fabric, dep.type }, provider.name, level));
+                        addDependencyTasks({ { over->fabric, dep.type } }, provider.name, level);
                         return;
                     }
                 }
@@ -220,43 +330,50 @@ Task::Ptr GetModDependenciesTask::prepareDependencyTask(const ModPlatform::Depen
                 qDebug() << doc;
                 return;
             }
-            pDep->version.is_currently_selected = true;
-            pDep->pack->versions = { pDep->version };
-            pDep->pack->versionsLoaded = true;
-
         } catch (const JSONValidationError& e) {
             removePack(dep.addonId);
             qDebug() << doc;
             qWarning() << "Error while reading mod version: " << e.cause();
             return;
         }
-        if (level == 0) {
-            removePack(dep.addonId);
-            qWarning() << "Dependency cycle exceeded";
-            return;
-        }
-        if (dep.addonId.toString().isEmpty() && !pDep->version.addonId.toString().isEmpty()) {
-            pDep->pack->addonId = pDep->version.addonId;
-            auto dep_ = getOverride({ pDep->version.addonId, pDep->dependency.type }, provider.name);
-            if (dep_.addonId != pDep->version.addonId) {
-                removePack(pDep->version.addonId);
-                addTask(prepareDependencyTask(dep_, provider.name, level));
-            } else {
-                addTask(getProjectInfoTask(pDep));
-            }
-        }
-        if (isLocalyInstalled(pDep)) {
-            removePack(pDep->version.addonId);
-            return;
-        }
-        for (auto dep_ : getDependenciesForVersion(pDep->version, provider.name)) {
-            addTask(prepareDependencyTask(dep_, provider.name, level - 1));
-        }
+
+        s_memoised_versions.insert(versionKey(dep, provider.name), { pDep->version, QDateTime::currentDateTimeUtc() });
+        dependencyVersionLoaded(pDep, provider.name, level);
     };
 
-    auto version = provider.api->getDependencyVersion(std::move(args), std::move(callbacks));
-    tasks->addTask(version);
-    return tasks;
+    return provider.api->getDependencyVersion(std::move(args), std::move(callbacks));
+}
+
+void GetModDependenciesTask::dependencyVersionLoaded(std::shared_ptr<PackDependency> pDep,
+                                                     const ModPlatform::ResourceProvider providerName,
+                                                     int level)
+{
+    auto dep = pDep->dependency;
+    pDep->version.is_currently_selected = true;
+    pDep->pack->versions = { pDep->version };
+    pDep->pack->versionsLoaded = true;
+
+    if (level == 0) {
+        removePack(dep.addonId);
+        qWarning() << "Dependency cycle exceeded";
+        return;
+    }
+    if (dep.addonId.toString().isEmpty() && !pDep->version.addonId.toString().isEmpty()) {
+        pDep->pack->addonId = pDep->version.addonId;
+        auto dep_ = getOverride({ pDep->version.addonId, pDep->dependency.type }, providerName);
+        if (dep_.addonId != pDep->version.addonId) {
+            removePack(pDep->version.addonId);
+            addDependencyTasks({ dep_ }, providerName, level);
+        } else if (!loadMemoisedProject(pDep)) {
+            addTask(getProjectInfoTask({ pDep }, providerName));
+        }
+    }
+    if (isLocalyInstalled(pDep)) {
+        removePack(pDep->version.addonId);
+        return;
+    }
+    if (auto deps = getDependenciesForVersion(pDep->version, providerName); !deps.isEmpty())
+        addDependencyTasks(deps, providerName, level - 1);
 }
 
 void GetModDependenciesTask::removePack(const QVariant& addonId)
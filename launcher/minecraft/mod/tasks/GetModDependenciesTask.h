@@ -29,11 +29,16 @@
 #include "minecraft/mod/ModFolderModel.h"
 #include "modplatform/ModIndex.h"
 #include "modplatform/ResourceAPI.h"
-#include "tasks/SequentialTask.h"
+#include "tasks/ConcurrentTask.h"
 #include "tasks/Task.h"
 #include "ui/pages/modplatform/ModModel.h"
 
-class GetModDependenciesTask : public SequentialTask {
+/** Resolves the required dependencies of the selected mods, recursively.
+ *
+ *  Lookups of separate dependencies run side by side, and each level's project info is fetched in one request.
+ *  Resolved dependency versions and project info are remembered across tasks for a while.
+ */
+class GetModDependenciesTask : public ConcurrentTask {
     Q_OBJECT
    public:
     using Ptr = shared_qobject_ptr<GetModDependenciesTask>;
@@ -67,11 +72,15 @@ class GetModDependenciesTask : public SequentialTask {
     QHash<QString, PackDependencyExtraInfo> getExtraInfo();
 
    protected slots:
-    Task::Ptr prepareDependencyTask(const ModPlatform::Dependency&, ModPlatform::ResourceProvider, int);
+    void addDependencyTasks(const QList<ModPlatform::Dependency>&, ModPlatform::ResourceProvider, int level);
+    Task::Ptr getDependencyVersionTask(std::shared_ptr<PackDependency> pDep, ModPlatform::ResourceProvider, int level);
+    void dependencyVersionLoaded(std::shared_ptr<PackDependency> pDep, ModPlatform::ResourceProvider, int level);
     QList<ModPlatform::Dependency> getDependenciesForVersion(const ModPlatform::IndexedVersion&,
                                                              ModPlatform::ResourceProvider providerName);
     void prepare();
-    Task::Ptr getProjectInfoTask(std::shared_ptr<PackDependency> pDep);
+    Task::Ptr getProjectInfoTask(QList<std::shared_ptr<PackDependency>> pDeps, ModPlatform::ResourceProvider providerName);
+    bool loadMemoisedProject(std::shared_ptr<PackDependency> pDep);
+    QString versionKey(const ModPlatform::Dependency& dep, ModPlatform::ResourceProvider providerName) const;
     ModPlatform::Dependency getOverride(const ModPlatform::Dependency&, ModPlatform::ResourceProvider providerName);
     void removePack(const QVariant& addonId);
 
@@ -23,6 +23,7 @@
 
 #include "FileSystem.h"
 #include "Json.h"
+#include "ResourceParseScheduler.h"
 
 #include <quazip/quazip.h>
 #include <quazip/quazipdir.h>
@@ -88,6 +89,7 @@ bool processZIP(DataPack& pack, ProcessingLevel level)
 {
     Q_ASSERT(pack.type() == ResourceType::ZIPFILE);
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(pack.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;  // can't open zip file
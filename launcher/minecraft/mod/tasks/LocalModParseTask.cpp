@@ -15,6 +15,9 @@
 #include "minecraft/mod/ModDetails.h"
 #include "settings/INIFile.h"
 
+#include "ResourceParseScheduler.h"
+#include "minecraft/mod/ResourceIconCache.h"
+
 namespace ModUtils {
 
 // NEW format
@@ -463,6 +466,7 @@ bool processZIP(Mod& mod, [[maybe_unused]] ProcessingLevel level)
 {
     ModDetails details;
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(mod.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;
@@ -617,6 +621,7 @@ bool processLitemod(Mod& mod, [[maybe_unused]] ProcessingLevel level)
 {
     ModDetails details;
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(mod.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;
@@ -649,7 +654,7 @@ bool validate(QFileInfo file)
 
 bool processIconPNG(const Mod& mod, QByteArray&& raw_data, QPixmap* pixmap)
 {
-    auto img = QImage::fromData(raw_data);
+    auto img = ResourceIconCache::decode(raw_data);
     if (!img.isNull()) {
         *pixmap = mod.setIcon(img);
     } else {
@@ -20,6 +20,8 @@
 
 #include "FileSystem.h"
 #include "Json.h"
+#include "ResourceParseScheduler.h"
+#include "minecraft/mod/ResourceIconCache.h"
 
 #include <quazip/quazip.h>
 #include <quazip/quazipdir.h>
@@ -108,6 +110,7 @@ bool processZIP(ResourcePack& pack, ProcessingLevel level)
 {
     Q_ASSERT(pack.type() == ResourceType::ZIPFILE);
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(pack.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;  // can't open zip file
@@ -280,7 +283,7 @@ bool processMCMeta(ResourcePack& pack, QByteArray&& raw_data)
 
 bool processPackPNG(const ResourcePack& pack, QByteArray&& raw_data)
 {
-    auto img = QImage::fromData(raw_data);
+    auto img = ResourceIconCache::decode(raw_data);
     if (!img.isNull()) {
         pack.setImage(img);
     } else {
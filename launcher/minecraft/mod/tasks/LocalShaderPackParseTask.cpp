@@ -22,6 +22,7 @@
 #include "LocalShaderPackParseTask.h"
 
 #include "FileSystem.h"
+#include "ResourceParseScheduler.h"
 
 #include <quazip/quazip.h>
 #include <quazip/quazipdir.h>
@@ -63,6 +64,7 @@ bool processZIP(ShaderPack& pack, ProcessingLevel level)
 {
     Q_ASSERT(pack.type() == ResourceType::ZIPFILE);
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(pack.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;  // can't open zip file
@@ -20,6 +20,8 @@
 #include "LocalTexturePackParseTask.h"
 
 #include "FileSystem.h"
+#include "ResourceParseScheduler.h"
+#include "minecraft/mod/ResourceIconCache.h"
 
 #include <quazip/quazip.h>
 #include <quazip/quazipfile.h>
@@ -91,6 +93,7 @@ bool processZIP(TexturePack& pack, ProcessingLevel level)
 {
     Q_ASSERT(pack.type() == ResourceType::ZIPFILE);
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(pack.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;
@@ -150,7 +153,7 @@ bool processPackTXT(TexturePack& pack, QByteArray&& raw_data)
 
 bool processPackPNG(const TexturePack& pack, QByteArray&& raw_data)
 {
-    auto img = QImage::fromData(raw_data);
+    auto img = ResourceIconCache::decode(raw_data);
     if (!img.isNull()) {
         pack.setImage(img);
     } else {
@@ -23,6 +23,7 @@
 #include "LocalWorldSaveParseTask.h"
 
 #include "FileSystem.h"
+#include "ResourceParseScheduler.h"
 
 #include <quazip/quazip.h>
 #include <quazip/quazipdir.h>
@@ -128,6 +129,7 @@ bool processZIP(WorldSave& save, ProcessingLevel level)
 {
     Q_ASSERT(save.type() == ResourceType::ZIPFILE);
 
+    ResourceParseScheduler::ZipHandle zip_handle;
     QuaZip zip(save.fileinfo().filePath());
     if (!zip.open(QuaZip::mdUnzip))
         return false;  // can't open zip file
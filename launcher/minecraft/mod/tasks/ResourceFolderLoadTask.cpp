@@ -55,7 +55,10 @@ ResourceFolderLoadTask::ResourceFolderLoadTask(const QDir& resource_dir,
     , m_create_func(create_function)
     , m_result(new Result())
     , m_thread_to_spawn_into(thread())
-{}
+{
+    if (auto app = APPLICATION_DYN)
+        m_use_index_cache = app->settings()->get("ModMetadataCache").toBool();
+}
 
 void ResourceFolderLoadTask::executeTask()
 {
@@ -135,12 +138,7 @@ void ResourceFolderLoadTask::executeTask()
 void ResourceFolderLoadTask::getFromMetadata()
 {
     m_index_dir.refresh();
-    for (auto entry : m_index_dir.entryList(QDir::Files)) {
-        auto metadata = Metadata::get(m_index_dir, entry);
-
-        if (!metadata.isValid())
-            continue;
-
+    for (auto& metadata : Metadata::getAll(m_index_dir, m_use_index_cache)) {
         auto* resource = m_create_func(QFileInfo(m_resource_dir.filePath(metadata.filename)));
         resource->setMetadata(metadata);
         resource->setStatus(ResourceStatus::NOT_INSTALLED);
@@ -76,6 +76,7 @@ class ResourceFolderLoadTask : public Task {
     QDir m_resource_dir, m_index_dir;
     bool m_is_indexed;
     bool m_clean_orphan;
+    bool m_use_index_cache = false;
     std::function<Resource*(QFileInfo const&)> m_create_func;
     ResultPtr m_result;
 
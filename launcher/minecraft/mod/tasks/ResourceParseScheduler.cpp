@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ResourceParseScheduler.h"
+
+#include <algorithm>
+
+#include <QDeadlineTimer>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+#include "Application.h"
+
+class ResourceParseScheduler::Worker : public QRunnable {
+   public:
+    explicit Worker(ResourceParseScheduler* scheduler) : m_scheduler(scheduler) { setAutoDelete(true); }
+    void run() override { m_scheduler->runWorker(); }
+
+   private:
+    ResourceParseScheduler* m_scheduler;
+};
+
+ResourceParseScheduler& ResourceParseScheduler::instance()
+{
+    static ResourceParseScheduler s_instance;
+    return s_instance;
+}
+
+ResourceParseScheduler::ResourceParseScheduler()
+    // Each open zip holds a file descriptor and its central directory in memory, so don't let them pile up
+    : m_max_concurrent(QThread::idealThreadCount()), m_zip_handles(qMax(4, QThread::idealThreadCount()))
+{
+    if (APPLICATION_DYN) {  // in tests the application macro doesn't work
+        setMaxConcurrent(APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
+    }
+}
+
+ResourceParseScheduler::ZipHandle::ZipHandle()
+{
+    instance().m_zip_handles.acquire();
+}
+
+ResourceParseScheduler::ZipHandle::~ZipHandle()
+{
+    instance().m_zip_handles.release();
+}
+
+void ResourceParseScheduler::setMaxConcurrent(int max_concurrent)
+{
+    QMutexLocker locker(&m_lock);
+    // Leave a thread of the global pool free, so folder updates can still run while a lot of parsing is going on
+    m_max_concurrent = qBound(1, max_concurrent, qMax(1, QThreadPool::globalInstance()->maxThreadCount() - 1));
+}
+
+void ResourceParseScheduler::schedule(const QObject* owner, Task::Ptr task)
+{
+    QMutexLocker locker(&m_lock);
+    m_background.append({ owner, task });
+
+    if (m_workers < m_max_concurrent) {
+        m_workers++;
+        QThreadPool::globalInstance()->start(new Worker(this));
+    }
+}
+
+void ResourceParseScheduler::prioritize(const QObject* owner, const QSet<Task*>& tasks)
+{
+    QMutexLocker locker(&m_lock);
+
+    QList<Entry> visible;
+    QList<Entry> demoted;
+    for (auto& entry : m_visible) {
+        if (entry.owner != owner || tasks.contains(entry.task.get()))
+            visible.append(entry);
+        else
+            demoted.append(entry);
+    }
+
+    QMutableListIterator<Entry> it(m_background);
+    while (it.hasNext()) {
+        auto& entry = it.next();
+        if (entry.owner == owner && tasks.contains(entry.task.get())) {
+            visible.append(entry);
+            it.remove();
+        }
+    }
+
+    m_visible = visible;
+    // Demoted tasks were queued before whatever is still in the background, so they keep going first
+    m_background = demoted + m_background;
+}
+
+QList<Task::Ptr> ResourceParseScheduler::cancel(const QObject* owner, bool abort_running)
+{
+    QList<Task::Ptr> dropped;
+    QList<Task::Ptr> running;
+    {
+        QMutexLocker locker(&m_lock);
+
+        for (auto* queue : { &m_visible, &m_background }) {
+            QMutableListIterator<Entry> it(*queue);
+            while (it.hasNext()) {
+                auto& entry = it.next();
+                if (entry.owner == owner) {
+                    dropped.append(entry.task);
+                    it.remove();
+                }
+            }
+        }
+
+        if (abort_running) {
+            for (auto& entry : m_running)
+                if (entry.owner == owner)
+                    running.append(entry.task);
+        }
+    }
+
+    // Abort outside the lock, since it can emit signals
+    for (auto& task : running)
+        task->abort();
+
+    return dropped;
+}
+
+bool ResourceParseScheduler::waitForOwner(const QObject* owner, unsigned long timeout)
+{
+    QDeadlineTimer deadline(timeout);
+    QMutexLocker locker(&m_lock);
+
+    auto has_running = [this, owner] {
+        return std::any_of(m_running.cbegin(), m_running.cend(), [owner](const Entry& entry) { return entry.owner == owner; });
+    };
+
+    while (has_running()) {
+        if (!m_task_finished.wait(&m_lock, deadline))
+            return !has_running();
+    }
+
+    return true;
+}
+
+void ResourceParseScheduler::runWorker()
+{
+    QMutexLocker locker(&m_lock);
+
+    while (true) {
+        auto& queue = m_visible.isEmpty() ? m_background : m_visible;
+        if (queue.isEmpty() || m_workers > m_max_concurrent)
+            break;
+
+        auto entry = queue.takeFirst();
+        m_running.append(entry);
+
+        locker.unlock();
+        entry.task->run();
+        locker.relock();
+
+        for (int i = 0; i < m_running.size(); i++) {
+            if (m_running.at(i).task == entry.task) {
+                m_running.removeAt(i);
+                break;
+            }
+        }
+        m_task_finished.wakeAll();
+    }
+
+    m_workers--;
+}
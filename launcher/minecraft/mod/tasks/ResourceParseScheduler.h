@@ -0,0 +1,85 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QList>
+#include <QMutex>
+#include <QObject>
+#include <QSemaphore>
+#include <QSet>
+#include <QWaitCondition>
+
+#include "tasks/Task.h"
+
+/** Runs the parse tasks of every resource folder model on a shared set of workers.
+ *
+ *  All models put their tasks in the same queues, and each worker takes the next task from whichever model has work
+ *  left, so one big folder doesn't leave the other workers idle. Tasks for rows that are visible in a view are taken
+ *  first, and the pending tasks of a model can be dropped when its page gets closed.
+ */
+class ResourceParseScheduler {
+   public:
+    static ResourceParseScheduler& instance();
+
+    /** Keeps the number of zip files open by parse tasks under a global limit, for as long as it lives. */
+    class ZipHandle {
+       public:
+        ZipHandle();
+        ~ZipHandle();
+    };
+
+    void setMaxConcurrent(int max_concurrent);
+
+    /** Queues 'task' to run in the background on behalf of 'owner'. */
+    void schedule(const QObject* owner, Task::Ptr task);
+
+    /** Moves the pending 'tasks' of 'owner' to the front of the queue, and the other ones of 'owner' back. */
+    void prioritize(const QObject* owner, const QSet<Task*>& tasks);
+
+    /** Drops the pending tasks of 'owner', and aborts its running ones if 'abort_running' is set.
+     *
+     *  Dropped tasks never start, so they won't emit any signal. Returns them so the caller can clean up after them.
+     */
+    QList<Task::Ptr> cancel(const QObject* owner, bool abort_running = true);
+
+    /** Waits up to 'timeout' ms for the running tasks of 'owner' to finish. Returns whether none are left. */
+    bool waitForOwner(const QObject* owner, unsigned long timeout);
+
+   private:
+    ResourceParseScheduler();
+
+    struct Entry {
+        const QObject* owner;
+        Task::Ptr task;
+    };
+
+    class Worker;
+    void runWorker();
+
+    QMutex m_lock;
+    QWaitCondition m_task_finished;
+
+    QList<Entry> m_visible;
+    QList<Entry> m_background;
+    QList<Entry> m_running;
+
+    int m_max_concurrent;
+    int m_workers = 0;
+
+    QSemaphore m_zip_handles;
+};
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "LibrariesManifest.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+#include "Json.h"
+
+namespace LibrariesManifest {
+static constexpr int s_format_version = 2;
+
+struct FileState {
+    QString path;
+    // -1 for files that aren't there
+    qint64 size = -1;
+    qint64 modified = 0;
+
+    bool operator==(const FileState& other) const { return path == other.path && size == other.size && modified == other.modified; }
+};
+
+static FileState fileState(const QString& path)
+{
+    QFileInfo info(path);
+    if (!info.isFile())
+        return { path };
+    return { path, info.size(), info.lastModified().toMSecsSinceEpoch() };
+}
+
+static QList<FileState> statAll(const QStringList& files)
+{
+    // libraries are spread all over the disk, so looking at them one at a time is mostly waiting
+    return QtConcurrent::blockingMapped<QList<FileState>>(files, fileState);
+}
+
+static bool allPresent(const QList<FileState>& states)
+{
+    return std::all_of(states.cbegin(), states.cend(), [](const FileState& state) { return state.size >= 0; });
+}
+
+bool verify(const QString& path, const QStringList& files, const QByteArray& metadata)
+{
+    if (!QFileInfo::exists(path))
+        return false;
+
+    QList<FileState> recorded;
+    try {
+        auto root = Json::requireObject(Json::requireDocument(path, "Libraries manifest"), "Libraries manifest");
+        if (Json::requireInteger(root, "formatVersion") != s_format_version)
+            return false;
+        if (Json::requireString(root, "metadata").toLatin1() != metadata.toHex())
+            return false;
+        for (const QJsonValue entry : Json::requireArray(root, "files")) {
+            auto file = Json::requireObject(entry);
+            recorded.append({ Json::requireString(file, "path"), static_cast<qint64>(Json::requireDouble(file, "size")),
+                              static_cast<qint64>(Json::requireDouble(file, "modified")) });
+        }
+    } catch (const Exception& e) {
+        qWarning() << "Ignoring unreadable libraries manifest" << path << ":" << e.cause();
+        return false;
+    }
+
+    if (recorded.size() != files.size())
+        return false;
+    for (int i = 0; i < files.size(); i++) {
+        if (recorded.at(i).path != files.at(i))
+            return false;
+    }
+    // a file that's gone has to be downloaded again, even if it was already missing last time
+    auto current = statAll(files);
+    return allPresent(current) && current == recorded;
+}
+
+bool write(const QString& path, const QStringList& files, const QByteArray& metadata)
+{
+    auto states = statAll(files);
+    if (!allPresent(states)) {
+        qWarning() << "Not writing libraries manifest" << path << "as some library files are missing";
+        QFile::remove(path);
+        return false;
+    }
+
+    QJsonArray entries;
+    for (auto& file : states)
+        entries.append(QJsonObject{ { "path", file.path }, { "size", file.size }, { "modified", file.modified } });
+
+    try {
+        QJsonObject root{ { "formatVersion", s_format_version },
+                          { "metadata", QString::fromLatin1(metadata.toHex()) },
+                          { "files", entries } };
+        Json::write(root, path);
+    } catch (const Exception& e) {
+        qWarning() << "Couldn't write libraries manifest" << path << ":" << e.cause();
+        return false;
+    }
+    return true;
+}
+}  // namespace LibrariesManifest
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+/** Remembers the library files of an instance as they were after all of them were last downloaded and checked.
+ *
+ *  As long as an instance wants the same files from the same library metadata, and all of them are still there with
+ *  the same size and modification time, there's nothing to download and nothing to check against the metadata cache.
+ *  The metadata is given as a digest of everything that decides what gets downloaded, like URLs and hashes, so a
+ *  library that changes where it comes from without changing its path gets checked again. The files get looked at in
+ *  parallel, and nothing gets hashed. Both functions do file IO and are meant to be run off the GUI thread.
+ */
+namespace LibrariesManifest {
+/** Whether 'files' and 'metadata' are what the manifest at 'path' was written for, and the files still look the same. */
+bool verify(const QString& path, const QStringList& files, const QByteArray& metadata);
+
+/** Records how 'files' look right now into the manifest at 'path'. Nothing is recorded if any of them is missing. */
+bool write(const QString& path, const QStringList& files, const QByteArray& metadata);
+}  // namespace LibrariesManifest
@@ -1,7 +1,16 @@
 #include "LibrariesTask.h"
 
+#include <QCryptographicHash>
+#include <QFutureWatcher>
+#include <QJsonDocument>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include "FileSystem.h"
 #include "minecraft/MinecraftInstance.h"
+#include "minecraft/OneSixVersionFormat.h"
 #include "minecraft/PackProfile.h"
+#include "minecraft/update/LibrariesManifest.h"
 
 #include "Application.h"
 
@@ -11,6 +20,69 @@ LibrariesTask::LibrariesTask(MinecraftInstance* inst)
 }
 
 void LibrariesTask::executeTask()
+{
+    setStatus(tr("Checking library files..."));
+    auto profile = m_inst->getPackProfile()->getProfile();
+    m_manifestPath = FS::PathCombine(m_inst->instanceRoot(), "libraries-verified.json");
+
+    // Work out which files the instance wants, and from where, without looking at any of them yet
+    m_files.clear();
+    QCryptographicHash metadata(QCryptographicHash::Sha1);
+    bool verifiable = true;
+    auto collectFiles = [this, &metadata, &verifiable](const QList<LibraryPtr>& pool, const QString& localPath) {
+        QStringList jar, native, native32, native64;
+        for (auto lib : pool) {
+            // always stale libraries have to be asked for again, and broken ones have to fail the usual way
+            if (!lib || lib->isAlwaysStale()) {
+                verifiable = false;
+                return;
+            }
+            lib->getApplicableFiles(m_inst->runtimeContext(), jar, native, native32, native64, localPath);
+            // URLs and hashes can change without the paths changing
+            metadata.addData(QJsonDocument(OneSixVersionFormat::libraryToJson(lib.get())).toJson(QJsonDocument::Compact));
+        }
+        m_files << jar << native << native32 << native64;
+    };
+    collectFiles(artifactPool(), m_inst->getLocalLibraryPath());
+    collectFiles(profile->getJarMods(), m_inst->jarModsDir());
+    m_metadata = metadata.result();
+
+    if (!verifiable) {
+        m_files.clear();
+        downloadLibraries();
+        return;
+    }
+
+    auto watcher = new QFutureWatcher<bool>(this);
+    connect(watcher, &QFutureWatcher<bool>::finished, this, [this, watcher] {
+        watcher->deleteLater();
+        if (!isRunning())
+            return;
+        if (watcher->result()) {
+            qDebug() << m_inst->name() << ": libraries are the same as when they were last verified";
+            emitSucceeded();
+            return;
+        }
+        downloadLibraries();
+    });
+    watcher->setFuture(QtConcurrent::run(LibrariesManifest::verify, m_manifestPath, m_files, m_metadata));
+}
+
+QList<LibraryPtr> LibrariesTask::artifactPool() const
+{
+    auto profile = m_inst->getPackProfile()->getProfile();
+    QList<LibraryPtr> libArtifactPool;
+    libArtifactPool.append(profile->getLibraries());
+    libArtifactPool.append(profile->getNativeLibraries());
+    libArtifactPool.append(profile->getMavenFiles());
+    for (auto agent : profile->getAgents()) {
+        libArtifactPool.append(agent->library());
+    }
+    libArtifactPool.append(profile->getMainJar());
+    return libArtifactPool;
+}
+
+void LibrariesTask::downloadLibraries()
 {
     setStatus(tr("Downloading required library files..."));
     qDebug() << m_inst->name() << ": downloading libraries";
@@ -40,15 +112,7 @@ void LibrariesTask::executeTask()
     };
 
     QStringList failedLocalLibraries;
-    QList<LibraryPtr> libArtifactPool;
-    libArtifactPool.append(profile->getLibraries());
-    libArtifactPool.append(profile->getNativeLibraries());
-    libArtifactPool.append(profile->getMavenFiles());
-    for (auto agent : profile->getAgents()) {
-        libArtifactPool.append(agent->library());
-    }
-    libArtifactPool.append(profile->getMainJar());
-    processArtifactPool(libArtifactPool, failedLocalLibraries, inst->getLocalLibraryPath());
+    processArtifactPool(artifactPool(), failedLocalLibraries, inst->getLocalLibraryPath());
 
     QStringList failedLocalJarMods;
     processArtifactPool(profile->getJarMods(), failedLocalJarMods, inst->jarModsDir());
@@ -62,7 +126,7 @@ void LibrariesTask::executeTask()
         return;
     }
 
-    connect(downloadJob.get(), &NetJob::succeeded, this, &LibrariesTask::emitSucceeded);
+    connect(downloadJob.get(), &NetJob::succeeded, this, &LibrariesTask::librariesDownloaded);
     connect(downloadJob.get(), &NetJob::failed, this, &LibrariesTask::jarlibFailed);
     connect(downloadJob.get(), &NetJob::aborted, this, [this] { emitFailed(tr("Aborted")); });
     connect(downloadJob.get(), &NetJob::progress, this, &LibrariesTask::progress);
@@ -71,6 +135,15 @@ void LibrariesTask::executeTask()
     downloadJob->start();
 }
 
+void LibrariesTask::librariesDownloaded()
+{
+    // an empty list means the files weren't collected, which happens when they couldn't be verified anyway
+    if (!m_files.isEmpty())
+        QThreadPool::globalInstance()->start(
+            [path = m_manifestPath, files = m_files, metadata = m_metadata] { LibrariesManifest::write(path, files, metadata); });
+    emitSucceeded();
+}
+
 bool LibrariesTask::canAbort() const
 {
     return true;
@@ -85,6 +158,9 @@ bool LibrariesTask::abort()
 {
     if (downloadJob) {
         return downloadJob->abort();
+    } else if (isRunning()) {
+        // still checking the files, which is left to finish on its own
+        emitAborted();
     } else {
         qWarning() << "Prematurely aborted LibrariesTask";
     }
@@ -1,4 +1,5 @@
 #pragma once
+#include "minecraft/Library.h"
 #include "net/NetJob.h"
 #include "tasks/Task.h"
 class MinecraftInstance;
@@ -15,11 +16,19 @@ class LibrariesTask : public Task {
 
    private slots:
     void jarlibFailed(QString reason);
+    void librariesDownloaded();
 
    public slots:
     bool abort() override;
 
    private:
+    QList<LibraryPtr> artifactPool() const;
+    void downloadLibraries();
+
     MinecraftInstance* m_inst;
     NetJob::Ptr downloadJob;
+    // the files the instance wants, a digest of the metadata they come from, and where to note down that they're all there
+    QStringList m_files;
+    QByteArray m_metadata;
+    QString m_manifestPath;
 };
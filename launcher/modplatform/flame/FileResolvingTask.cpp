@@ -43,6 +43,9 @@ bool Flame::FileResolvingTask::abort()
     if (m_task) {
         aborted = m_task->abort();
     }
+    if (m_projects_task) {
+        aborted &= m_projects_task->abort();
+    }
     return aborted ? Task::abort() : false;
 }
 
@@ -54,6 +57,12 @@ void Flame::FileResolvingTask::executeTask()
     }
     setStatus(tr("Resolving mod IDs..."));
     setProgress(0, 3);
+    m_files_resolved = false;
+    m_projects_resolved = false;
+
+    // The project information only depends on the manifest, so fetch it while the files are being resolved
+    getFlameProjects();
+
     m_result.reset(new QByteArray());
 
     QStringList fileIds;
@@ -127,7 +136,7 @@ void Flame::FileResolvingTask::netJobFinished()
         }
     }
     if (hashes.isEmpty()) {
-        getFlameProjects();
+        filesResolved();
         return;
     }
     m_result.reset(new QByteArray());
@@ -175,7 +184,7 @@ void Flame::FileResolvingTask::netJobFinished()
             qDebug() << e.cause();
             qDebug() << doc;
         }
-        getFlameProjects();
+        filesResolved();
     });
     connect(m_task.get(), &Task::failed, this, [this, step_progress](QString reason) {
         step_progress->state = TaskStepState::Failed;
@@ -195,25 +204,32 @@ void Flame::FileResolvingTask::netJobFinished()
     m_task->start();
 }
 
-void Flame::FileResolvingTask::getFlameProjects()
+void Flame::FileResolvingTask::filesResolved()
 {
     setProgress(2, 3);
-    m_result.reset(new QByteArray());
+    m_files_resolved = true;
+    if (m_projects_resolved)
+        emitSucceeded();
+}
+
+void Flame::FileResolvingTask::getFlameProjects()
+{
+    auto result = std::make_shared<QByteArray>();
     QStringList addonIds;
     for (auto file : m_manifest.files) {
         addonIds.push_back(QString::number(file.projectId));
     }
 
-    m_task = flameAPI.getProjects(addonIds, m_result);
+    m_projects_task = flameAPI.getProjects(addonIds, result);
 
     auto step_progress = std::make_shared<TaskStepProgress>();
-    connect(m_task.get(), &Task::succeeded, this, [this, step_progress] {
+    connect(m_projects_task.get(), &Task::succeeded, this, [this, step_progress, result] {
         QJsonParseError parse_error{};
-        auto doc = QJsonDocument::fromJson(*m_result, &parse_error);
+        auto doc = QJsonDocument::fromJson(*result, &parse_error);
         if (parse_error.error != QJsonParseError::NoError) {
             qWarning() << "Error while parsing JSON response from Modrinth projects task at " << parse_error.offset
                        << " reason: " << parse_error.errorString();
-            qWarning() << *m_result;
+            qWarning() << *result;
             return;
         }
 
@@ -230,7 +246,6 @@ void Flame::FileResolvingTask::getFlameProjects()
                     continue;
                 }
 
-                setStatus(tr("Parsing API response from CurseForge for '%1'...").arg(file->version.fileName));
                 FlameMod::loadIndexedPack(file->pack, entry_obj);
             }
         } catch (Json::JsonException& e) {
@@ -239,24 +254,26 @@ void Flame::FileResolvingTask::getFlameProjects()
         }
         step_progress->state = TaskStepState::Succeeded;
         stepProgress(*step_progress);
-        emitSucceeded();
+        m_projects_resolved = true;
+        if (m_files_resolved)
+            emitSucceeded();
     });
 
-    connect(m_task.get(), &Task::failed, this, [this, step_progress](QString reason) {
+    connect(m_projects_task.get(), &Task::failed, this, [this, step_progress](QString reason) {
         step_progress->state = TaskStepState::Failed;
         stepProgress(*step_progress);
         emitFailed(reason);
     });
-    connect(m_task.get(), &Task::stepProgress, this, &FileResolvingTask::propagateStepProgress);
-    connect(m_task.get(), &Task::progress, this, [this, step_progress](qint64 current, qint64 total) {
+    connect(m_projects_task.get(), &Task::stepProgress, this, &FileResolvingTask::propagateStepProgress);
+    connect(m_projects_task.get(), &Task::progress, this, [this, step_progress](qint64 current, qint64 total) {
         qDebug() << "Resolve slug progress" << current << total;
         step_progress->update(current, total);
         stepProgress(*step_progress);
     });
-    connect(m_task.get(), &Task::status, this, [this, step_progress](QString status) {
+    connect(m_projects_task.get(), &Task::status, this, [this, step_progress](QString status) {
         step_progress->status = status;
         stepProgress(*step_progress);
     });
 
-    m_task->start();
+    m_projects_task->start();
 }
@@ -42,11 +42,15 @@ class FileResolvingTask : public Task {
 
    private:
     void getFlameProjects();
+    void filesResolved();
 
    private: /* data */
     shared_qobject_ptr<QNetworkAccessManager> m_network;
     Flame::Manifest m_manifest;
     std::shared_ptr<QByteArray> m_result;
     Task::Ptr m_task;
+    Task::Ptr m_projects_task;
+    bool m_files_resolved = false;
+    bool m_projects_resolved = false;
 };
 }  // namespace Flame
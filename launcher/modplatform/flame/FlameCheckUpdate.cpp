@@ -12,132 +12,255 @@
 
 #include "minecraft/mod/ModFolderModel.h"
 #include "minecraft/mod/tasks/GetModDependenciesTask.h"
+#include "modplatform/helpers/UpdateCheckCache.h"
 
-#include "net/ApiDownload.h"
+#include "tasks/ConcurrentTask.h"
 
 static FlameAPI api;
 
 bool FlameCheckUpdate::abort()
 {
-    m_was_aborted = true;
-    if (m_net_job)
-        return m_net_job->abort();
+    if (m_job)
+        return m_job->abort();
     return true;
 }
 
-ModPlatform::IndexedPack FlameCheckUpdate::getProjectInfo(ModPlatform::IndexedVersion& ver_info)
+template <typename Request>
+static QList<std::shared_ptr<QByteArray>> addBatches(ConcurrentTask& job, const QStringList& ids, Request request)
 {
-    ModPlatform::IndexedPack pack;
+    QList<std::shared_ptr<QByteArray>> responses;
+    for (qsizetype i = 0; i < ids.size(); i += FlameCheckUpdate::s_max_ids_per_request) {
+        auto response = std::make_shared<QByteArray>();
+        job.addTask(request(ids.mid(i, FlameCheckUpdate::s_max_ids_per_request), response));
+        responses.append(response);
+    }
+    return responses;
+}
 
-    QEventLoop loop;
+static std::optional<QJsonArray> parseData(const QByteArray& response)
+{
+    QJsonParseError parse_error{};
+    QJsonDocument doc = QJsonDocument::fromJson(response, &parse_error);
+    if (parse_error.error != QJsonParseError::NoError) {
+        qWarning() << "Error while parsing JSON response from FlameCheckUpdate at " << parse_error.offset
+                   << " reason: " << parse_error.errorString();
+        qWarning() << response;
+        return {};
+    }
+    return doc.object().value("data").toArray();
+}
 
-    auto get_project_job = new NetJob("Flame::GetProjectJob", APPLICATION->network());
+/* Check for update:
+ * - Get the projects of all resources at once, which list their latest files for each game version
+ * - Get all of those files at once, and all files of the projects that list none for the game version
+ * - Pick the latest version for each resource, and compare its hash with the current hash
+ * - If equal, no updates, else, there's updates, so add to the list
+ * Projects that some check asked about recently are served from the update check cache instead.
+ * */
+void FlameCheckUpdate::executeTask()
+{
+    setStatus(tr("Preparing resources for CurseForge..."));
+    setProgress(0, 3);
 
-    auto response = std::make_shared<QByteArray>();
-    auto url = QString("https://api.curseforge.com/v1/mods/%1").arg(ver_info.addonId.toString());
-    auto dl = Net::ApiDownload::makeByteArray(url, response);
-    get_project_job->addNetAction(dl);
+    m_game_version = m_game_versions.empty() ? QString() : m_game_versions.front().toString();
+    // the fallback asks about all of the game versions, so answers are only good for that same list
+    QStringList game_versions;
+    for (auto& version : m_game_versions)
+        game_versions.append(version.toString());
+    m_cache_context = game_versions.join(',');
 
-    QObject::connect(get_project_job, &NetJob::succeeded, [response, &pack]() {
-        QJsonParseError parse_error{};
-        QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
-        if (parse_error.error != QJsonParseError::NoError) {
-            qWarning() << "Error while parsing JSON response from FlameCheckUpdate at " << parse_error.offset
-                       << " reason: " << parse_error.errorString();
-            qWarning() << *response;
-            return;
-        }
+    for (auto* resource : m_resources) {
+        auto project_id = resource->metadata()->project_id.toString();
+        if (m_fetched_ids.contains(project_id) || m_projects.contains(project_id) || m_files.contains(project_id))
+            continue;
+        if (auto answer = UpdateCheckCache::instance().find(ModPlatform::ResourceProvider::FLAME, project_id, m_cache_context))
+            loadAnswer(project_id, answer->toObject());
+        else
+            m_fetched_ids.append(project_id);
+    }
 
-        try {
-            auto doc_obj = Json::requireObject(doc);
-            auto data_obj = Json::requireObject(doc_obj, "data");
-            FlameMod::loadIndexedPack(pack, data_obj);
-        } catch (Json::JsonException& e) {
-            qWarning() << e.cause();
-            qDebug() << doc;
-        }
-    });
+    if (m_fetched_ids.isEmpty()) {
+        checkResources();
+        return;
+    }
 
-    connect(get_project_job, &NetJob::failed, this, &FlameCheckUpdate::emitFailed);
-    QObject::connect(get_project_job, &NetJob::finished, [&loop, get_project_job] {
-        get_project_job->deleteLater();
-        loop.quit();
+    setStatus(tr("Getting API response from CurseForge..."));
+    auto job = makeShared<ConcurrentTask>("FlameGetProjectsTask", APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
+    auto responses = addBatches(*job, m_fetched_ids, [](QStringList ids, std::shared_ptr<QByteArray> response) {
+        return api.getProjects(ids, response);
     });
 
-    get_project_job->start();
-    loop.exec();
+    connect(job.get(), &Task::succeeded, this, [this, responses] { getLatestFiles(responses); });
+    connect(job.get(), &Task::failed, this, &FlameCheckUpdate::emitFailed);
+    connect(job.get(), &Task::aborted, this, &FlameCheckUpdate::emitAborted);
 
-    return pack;
+    m_job = job;
+    job->start();
 }
 
-ModPlatform::IndexedVersion FlameCheckUpdate::getFileInfo(int addonId, int fileId)
+void FlameCheckUpdate::getLatestFiles(QList<std::shared_ptr<QByteArray>> responses)
 {
-    ModPlatform::IndexedVersion ver;
+    setStatus(tr("Parsing the API response from CurseForge..."));
+    setProgress(1, 3);
+
+    QStringList file_ids;
+    for (auto& response : responses) {
+        auto data = parseData(*response);
+        if (!data.has_value()) {
+            emitFailed(tr("Failed to parse the API response from CurseForge"));
+            return;
+        }
 
-    QEventLoop loop;
+        for (auto project : *data) {
+            try {
+                auto project_obj = Json::requireObject(project);
+                m_project_json.insert(QString::number(Json::requireInteger(project_obj, "id")), project_obj);
+
+                // Same as asking for the files of the first game version, except that it's one request for everything
+                for (auto index : Json::ensureArray(project_obj, "latestFilesIndexes")) {
+                    auto index_obj = Json::requireObject(index);
+                    if (!m_game_version.isEmpty() && Json::ensureString(index_obj, "gameVersion") != m_game_version)
+                        continue;
+                    auto file_id = QString::number(Json::requireInteger(index_obj, "fileId"));
+                    if (!file_ids.contains(file_id))
+                        file_ids.append(file_id);
+                }
+            } catch (Json::JsonException& e) {
+                qWarning() << e.cause();
+            }
+        }
+    }
 
-    auto get_file_info_job = new NetJob("Flame::GetFileInfoJob", APPLICATION->network());
+    if (file_ids.isEmpty()) {
+        getFallbackFiles();
+        return;
+    }
 
-    auto response = std::make_shared<QByteArray>();
-    auto url = QString("https://api.curseforge.com/v1/mods/%1/files/%2").arg(QString::number(addonId), QString::number(fileId));
-    auto dl = Net::ApiDownload::makeByteArray(url, response);
-    get_file_info_job->addNetAction(dl);
+    setStatus(tr("Getting API response from CurseForge..."));
+    auto job = makeShared<ConcurrentTask>("FlameGetFilesTask", APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
+    auto file_responses = addBatches(*job, file_ids, [](QStringList ids, std::shared_ptr<QByteArray> response) {
+        return api.getFiles(ids, response);
+    });
 
-    QObject::connect(get_file_info_job, &NetJob::succeeded, [response, &ver]() {
-        QJsonParseError parse_error{};
-        QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
-        if (parse_error.error != QJsonParseError::NoError) {
-            qWarning() << "Error while parsing JSON response from FlameCheckUpdate at " << parse_error.offset
-                       << " reason: " << parse_error.errorString();
-            qWarning() << *response;
-            return;
-        }
+    connect(job.get(), &Task::succeeded, this, [this, file_responses] {
+        for (auto& response : file_responses) {
+            auto data = parseData(*response);
+            if (!data.has_value()) {
+                emitFailed(tr("Failed to parse the API response from CurseForge"));
+                return;
+            }
 
-        try {
-            auto doc_obj = Json::requireObject(doc);
-            auto data_obj = Json::requireObject(doc_obj, "data");
-            ver = FlameMod::loadIndexedPackVersion(data_obj);
-        } catch (Json::JsonException& e) {
-            qWarning() << e.cause();
-            qDebug() << doc;
+            for (auto file : *data) {
+                try {
+                    auto file_obj = Json::requireObject(file);
+                    m_file_json[QString::number(Json::requireInteger(file_obj, "modId"))].append(file_obj);
+                } catch (Json::JsonException& e) {
+                    qWarning() << e.cause();
+                }
+            }
         }
+        getFallbackFiles();
     });
-    connect(get_file_info_job, &NetJob::failed, this, &FlameCheckUpdate::emitFailed);
-    QObject::connect(get_file_info_job, &NetJob::finished, [&loop, get_file_info_job] {
-        get_file_info_job->deleteLater();
-        loop.quit();
-    });
-
-    get_file_info_job->start();
-    loop.exec();
+    connect(job.get(), &Task::failed, this, &FlameCheckUpdate::emitFailed);
+    connect(job.get(), &Task::aborted, this, &FlameCheckUpdate::emitAborted);
 
-    return ver;
+    m_job = job;
+    job->start();
 }
 
-/* Check for update:
- * - Get latest version available
- * - Compare hash of the latest version with the current hash
- * - If equal, no updates, else, there's updates, so add to the list
- * */
-void FlameCheckUpdate::executeTask()
+void FlameCheckUpdate::getFallbackFiles()
 {
-    setStatus(tr("Preparing resources for CurseForge..."));
+    // A project that lists no file for the game version may still have some, as that list isn't guaranteed to be complete.
+    // Those are asked for all of their files for the game version, side by side.
+    auto job = makeShared<ConcurrentTask>("FlameGetLatestVersionsTask", APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
+    int requests = 0;
+    for (auto& project_id : m_fetched_ids) {
+        if (!m_project_json.contains(project_id) || m_file_json.contains(project_id) || m_game_versions.empty())
+            continue;
 
-    int i = 0;
-    for (auto* resource : m_resources) {
-        setStatus(tr("Getting API response from CurseForge for '%1'...").arg(resource->name()));
-        setProgress(i++, m_resources.size());
+        ModPlatform::IndexedPack pack;
+        pack.addonId = project_id;
+        pack.name = Json::ensureString(m_project_json.value(project_id), "name");
+
+        // until its files come back, the project has no answer worth keeping
+        m_unanswered_ids.insert(project_id);
+
+        ResourceAPI::VersionSearchCallbacks callbacks;
+        callbacks.on_succeed = [this, project_id](QJsonDocument& doc, const ModPlatform::IndexedPack&) {
+            m_unanswered_ids.remove(project_id);
+            for (auto file : doc.object().value("data").toArray())
+                if (file.isObject())
+                    m_file_json[project_id].append(file);
+        };
+        callbacks.on_fail = [project_id](QString const& reason, int) {
+            qWarning() << "Failed to get the files of CurseForge project" << project_id << ":" << reason;
+        };
+        if (auto task = api.getProjectVersions({ pack, m_game_versions }, std::move(callbacks))) {
+            job->addTask(task);
+            requests++;
+        }
+    }
 
-        auto latest_vers = api.getLatestVersions({ { resource->metadata()->project_id.toString() }, m_game_versions });
+    if (requests == 0) {
+        finishFetching();
+        return;
+    }
 
-        // Check if we were aborted while getting the latest version
-        if (m_was_aborted) {
-            aborted();
-            return;
+    setStatus(tr("Getting API response from CurseForge..."));
+    // Projects whose files couldn't be fetched are reported as having no valid version, like before, but not remembered that way
+    connect(job.get(), &Task::succeeded, this, &FlameCheckUpdate::finishFetching);
+    connect(job.get(), &Task::failed, this, &FlameCheckUpdate::finishFetching);
+    connect(job.get(), &Task::aborted, this, &FlameCheckUpdate::emitAborted);
+
+    m_job = job;
+    job->start();
+}
+
+void FlameCheckUpdate::finishFetching()
+{
+    for (auto& project_id : m_fetched_ids) {
+        QJsonObject answer;
+        if (m_project_json.contains(project_id))
+            answer.insert("project", m_project_json.value(project_id));
+        answer.insert("files", m_file_json.value(project_id));
+
+        if (!m_unanswered_ids.contains(project_id))
+            UpdateCheckCache::instance().insert(ModPlatform::ResourceProvider::FLAME, project_id, m_cache_context, answer);
+        loadAnswer(project_id, answer);
+    }
+    checkResources();
+}
+
+void FlameCheckUpdate::loadAnswer(const QString& project_id, const QJsonObject& answer)
+{
+    try {
+        if (answer.contains("project")) {
+            auto project_obj = Json::requireObject(answer, "project");
+            ModPlatform::IndexedPack pack;
+            FlameMod::loadIndexedPack(pack, project_obj);
+            m_projects.insert(project_id, pack);
         }
-        auto latest_ver = api.getLatestVersion(latest_vers, m_loaders_list, resource->metadata()->loaders);
+        auto& files = m_files[project_id];
+        for (auto file : Json::ensureArray(answer, "files")) {
+            auto version = FlameMod::loadIndexedPackVersion(Json::requireObject(file));
+            if (version.addonId.isValid())
+                files.append(version);
+        }
+    } catch (Json::JsonException& e) {
+        qWarning() << e.cause();
+    }
+}
+
+void FlameCheckUpdate::checkResources()
+{
+    setStatus(tr("Parsing the API response from CurseForge..."));
+    setProgress(2, 3);
 
-        setStatus(tr("Parsing the API response from CurseForge for '%1'...").arg(resource->name()));
+    for (auto* resource : m_resources) {
+        auto project_id = resource->metadata()->project_id.toString();
+
+        auto latest_vers = m_files.value(project_id);
+        auto latest_ver = api.getLatestVersion(latest_vers, m_loaders_list, resource->metadata()->loaders);
 
         if (!latest_ver.has_value() || !latest_ver->addonId.isValid()) {
             QString reason;
@@ -153,8 +276,7 @@ void FlameCheckUpdate::executeTask()
         }
 
         if (latest_ver->downloadUrl.isEmpty() && latest_ver->fileId != resource->metadata()->file_id) {
-            auto pack = getProjectInfo(latest_ver.value());
-            auto recover_url = QString("%1/download/%2").arg(pack.websiteUrl, latest_ver->fileId.toString());
+            auto recover_url = QString("%1/download/%2").arg(m_projects.value(project_id).websiteUrl, latest_ver->fileId.toString());
             emit checkFailed(resource, tr("Resource has a new update available, but is not downloadable using CurseForge."), recover_url);
 
             continue;
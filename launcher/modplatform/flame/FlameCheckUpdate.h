@@ -1,5 +1,9 @@
 #pragma once
 
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QSet>
+
 #include "Application.h"
 #include "modplatform/CheckUpdateTask.h"
 #include "net/NetJob.h"
@@ -15,6 +19,9 @@ class FlameCheckUpdate : public CheckUpdateTask {
         : CheckUpdateTask(resources, mcVersions, std::move(loadersList), std::move(resourceModel))
     {}
 
+    // How many project or file IDs go into a single request
+    static constexpr qsizetype s_max_ids_per_request = 500;
+
    public slots:
     bool abort() override;
 
@@ -22,10 +29,22 @@ class FlameCheckUpdate : public CheckUpdateTask {
     void executeTask() override;
 
    private:
-    ModPlatform::IndexedPack getProjectInfo(ModPlatform::IndexedVersion& ver_info);
-    ModPlatform::IndexedVersion getFileInfo(int addonId, int fileId);
-
-    NetJob* m_net_job = nullptr;
-
-    bool m_was_aborted = false;
+    void getLatestFiles(QList<std::shared_ptr<QByteArray>> responses);
+    void getFallbackFiles();
+    void finishFetching();
+    void loadAnswer(const QString& project_id, const QJsonObject& answer);
+    void checkResources();
+
+    Task::Ptr m_job = nullptr;
+    QString m_game_version;
+    QString m_cache_context;
+    // projects that weren't in the update check cache, and what the API said about them
+    QStringList m_fetched_ids;
+    // projects whose files couldn't be fetched, so their answer is incomplete
+    QSet<QString> m_unanswered_ids;
+    QHash<QString, QJsonObject> m_project_json;
+    QHash<QString, QJsonArray> m_file_json;
+
+    QHash<QString, ModPlatform::IndexedPack> m_projects;
+    QHash<QString, QList<ModPlatform::IndexedVersion>> m_files;
 };
@@ -79,6 +79,8 @@ bool FlameCreationTask::abort()
         m_process_update_file_info_job->abort();
     if (m_files_job)
         m_files_job->abort();
+    if (m_optional_files_job)
+        m_optional_files_job->abort();
     if (m_mod_id_resolver)
         m_mod_id_resolver->abort();
 
@@ -165,13 +167,14 @@ bool FlameCreationTask::updateInstance()
 
         QDir old_minecraft_dir(inst->gameRoot());
 
-        // We will remove all the previous overrides, to prevent duplicate files!
-        // TODO: Currently 'overrides' will always override the stuff on update. How do we preserve unchanged overrides?
+        // Only touch the overrides that changed, and leave alone the ones the user edited.
         // FIXME: We may want to do something about disabled mods.
-        auto old_overrides = Override::readOverrides("overrides", old_index_folder);
-        for (const auto& entry : old_overrides) {
-            if (entry.isEmpty())
-                continue;
+        QDir staged_overrides(FS::PathCombine(m_stagingPath, m_pack.overrides));
+        auto overrides_diff = Override::diffOverrides("overrides", old_index_folder, inst->gameRoot(),
+                                                      m_pack.overrides.isEmpty() ? QString() : staged_overrides.absolutePath());
+        for (const auto& entry : overrides_diff.to_keep)
+            m_overrides_to_skip.append(staged_overrides.absoluteFilePath(entry));
+        for (const auto& entry : overrides_diff.to_remove) {
             qDebug() << "Scheduling" << entry << "for removal";
             m_files_to_remove.append(old_minecraft_dir.absoluteFilePath(entry));
         }
@@ -336,6 +339,7 @@ bool FlameCreationTask::createInstance()
         if (QFile::exists(overridePath)) {
             // Create a list of overrides in "overrides.txt" inside flame/
             Override::createOverrides("overrides", parent_folder, overridePath);
+            Override::skipOverrides(overridePath, m_overrides_to_skip);
 
             QString mcPath = FS::PathCombine(m_stagingPath, "minecraft");
             if (!FS::move(overridePath, mcPath)) {
@@ -470,6 +474,15 @@ void FlameCreationTask::idResolverSucceeded(QEventLoop& loop)
 {
     auto results = m_mod_id_resolver->getResults();
 
+    // The required files don't depend on any choice of the user, so they can already download while the dialogs below are up
+    m_running_download_jobs = 1;
+    m_files_job.reset(new NetJob(tr("Mod Download Flame"), APPLICATION->network()));
+    for (const auto& result : results.files) {
+        if (result.required)
+            addFileDownload(m_files_job, result, false);
+    }
+    startDownloadJob(m_files_job, loop);
+
     // first check for blocked mods
     QList<BlockedMod> blocked_mods;
     auto anyBlocked = false;
@@ -507,6 +520,7 @@ void FlameCreationTask::idResolverSucceeded(QEventLoop& loop)
             copyBlockedMods(blocked_mods);
             setupDownloadJob(loop);
         } else {
+            cancelDownloadJobs();
             m_mod_id_resolver.reset();
             setError("Canceled");
             loop.quit();
@@ -518,7 +532,6 @@ void FlameCreationTask::idResolverSucceeded(QEventLoop& loop)
 
 void FlameCreationTask::setupDownloadJob(QEventLoop& loop)
 {
-    m_files_job.reset(new NetJob(tr("Mod Download Flame"), APPLICATION->network()));
     auto results = m_mod_id_resolver->getResults().files;
 
     QStringList optionalFiles;
@@ -528,52 +541,82 @@ void FlameCreationTask::setupDownloadJob(QEventLoop& loop)
         }
     }
 
-    QStringList selectedOptionalMods;
     if (!optionalFiles.empty()) {
         OptionalModDialog optionalModDialog(m_parent, optionalFiles);
         if (optionalModDialog.exec() == QDialog::Rejected) {
+            cancelDownloadJobs();
             emitAborted();
             loop.quit();
             return;
         }
 
-        selectedOptionalMods = optionalModDialog.getResult();
-    }
-    for (const auto& result : results) {
-        auto fileName = result.version.fileName;
-        fileName = FS::RemoveInvalidPathChars(fileName);
-        auto relpath = FS::PathCombine(result.targetFolder, fileName);
+        auto selectedOptionalMods = optionalModDialog.getResult();
 
-        if (!result.required && !selectedOptionalMods.contains(relpath)) {
-            relpath += ".disabled";
+        m_optional_files_job.reset(new NetJob(tr("Optional Mod Download Flame"), APPLICATION->network()));
+        for (const auto& result : results) {
+            if (!result.required) {
+                auto relpath = FS::PathCombine(result.targetFolder, FS::RemoveInvalidPathChars(result.version.fileName));
+                addFileDownload(m_optional_files_job, result, !selectedOptionalMods.contains(relpath));
+            }
         }
+        startDownloadJob(m_optional_files_job, loop);
+    }
 
-        relpath = FS::PathCombine("minecraft", relpath);
-        auto path = FS::PathCombine(m_stagingPath, relpath);
+    // We're done with the dialogs, let the download jobs finish up
+    downloadJobFinished(loop);
+}
 
-        if (!result.version.downloadUrl.isEmpty()) {
-            qDebug() << "Will download" << result.version.downloadUrl << "to" << path;
-            auto dl = Net::ApiDownload::makeFile(result.version.downloadUrl, path);
-            m_files_job->addNetAction(dl);
-        }
-    }
+void FlameCreationTask::addFileDownload(NetJob::Ptr job, const Flame::File& result, bool disabled)
+{
+    if (result.version.downloadUrl.isEmpty())
+        return;
 
-    connect(m_files_job.get(), &NetJob::finished, this, [this, &loop]() {
-        m_files_job.reset();
-        validateZIPResources(loop);
-    });
-    connect(m_files_job.get(), &NetJob::failed, [this](QString reason) {
-        m_files_job.reset();
-        setError(reason);
-    });
-    connect(m_files_job.get(), &NetJob::progress, this, [this](qint64 current, qint64 total) {
+    auto relpath = FS::PathCombine(result.targetFolder, FS::RemoveInvalidPathChars(result.version.fileName));
+    if (disabled)
+        relpath += ".disabled";
+
+    auto path = FS::PathCombine(m_stagingPath, "minecraft", relpath);
+
+    qDebug() << "Will download" << result.version.downloadUrl << "to" << path;
+    job->addNetAction(Net::ApiDownload::makeFile(result.version.downloadUrl, path));
+}
+
+void FlameCreationTask::startDownloadJob(NetJob::Ptr job, QEventLoop& loop)
+{
+    m_running_download_jobs++;
+
+    connect(job.get(), &NetJob::finished, this, [this, &loop]() { downloadJobFinished(loop); });
+    connect(job.get(), &NetJob::failed, this, [this](QString reason) { setError(reason); });
+    connect(job.get(), &NetJob::progress, this, [this](qint64 current, qint64 total) {
         setDetails(tr("%1 out of %2 complete").arg(current).arg(total));
         setProgress(current, total);
     });
-    connect(m_files_job.get(), &NetJob::stepProgress, this, &FlameCreationTask::propagateStepProgress);
+    connect(job.get(), &NetJob::stepProgress, this, &FlameCreationTask::propagateStepProgress);
 
     setStatus(tr("Downloading mods..."));
-    m_files_job->start();
+    job->start();
+}
+
+void FlameCreationTask::downloadJobFinished(QEventLoop& loop)
+{
+    if (--m_running_download_jobs > 0)
+        return;
+
+    m_files_job.reset();
+    m_optional_files_job.reset();
+    validateZIPResources(loop);
+}
+
+void FlameCreationTask::cancelDownloadJobs()
+{
+    for (auto job : { m_files_job, m_optional_files_job }) {
+        if (!job)
+            continue;
+        job->disconnect(this);
+        job->abort();
+    }
+    m_files_job.reset();
+    m_optional_files_job.reset();
 }
 
 /// @brief copy the matched blocked mods to the instance staging area
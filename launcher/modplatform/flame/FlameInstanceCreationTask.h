@@ -73,6 +73,10 @@ class FlameCreationTask final : public InstanceCreationTask {
    private slots:
     void idResolverSucceeded(QEventLoop&);
     void setupDownloadJob(QEventLoop&);
+    void addFileDownload(NetJob::Ptr job, const Flame::File& result, bool disabled);
+    void startDownloadJob(NetJob::Ptr job, QEventLoop& loop);
+    void downloadJobFinished(QEventLoop& loop);
+    void cancelDownloadJobs();
     void copyBlockedMods(QList<BlockedMod> const& blocked_mods);
     void validateZIPResources(QEventLoop& loop);
     QString getVersionForLoader(QString uid, QString loaderType, QString version, QString mcVersion);
@@ -86,6 +90,9 @@ class FlameCreationTask final : public InstanceCreationTask {
     // Handle to allow aborting
     Task::Ptr m_process_update_file_info_job = nullptr;
     NetJob::Ptr m_files_job = nullptr;
+    NetJob::Ptr m_optional_files_job = nullptr;
+    // the download jobs still running, plus one while the user is picking blocked and optional mods
+    int m_running_download_jobs = 0;
 
     QString m_managed_id, m_managed_version_id;
 
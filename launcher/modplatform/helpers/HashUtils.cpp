@@ -1,8 +1,12 @@
 #include "HashUtils.h"
 
 #include <QBuffer>
+#include <QDateTime>
 #include <QDebug>
 #include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QMutex>
 #include <QtConcurrentRun>
 
 #include <MurmurHash2.h>
@@ -123,10 +127,40 @@ QString hash(QIODevice* device, Algorithm type)
     return result;
 }
 
+namespace {
+struct CachedHash {
+    qint64 size;
+    qint64 modified;
+    QString hash;
+};
+
+// Update checks and metadata lookups of every page end up hashing the same files, so keep what we already know
+QMutex s_cache_lock;
+QHash<QString, CachedHash> s_cache;
+}  // namespace
+
 QString hash(QString fileName, Algorithm type)
 {
+    QFileInfo info(fileName);
+    auto key = algorithmToString(type) + ':' + info.canonicalFilePath();
+    auto size = info.size();
+    auto modified = info.lastModified().toMSecsSinceEpoch();
+
+    if (!info.canonicalFilePath().isEmpty()) {
+        QMutexLocker locker(&s_cache_lock);
+        auto entry = s_cache.constFind(key);
+        if (entry != s_cache.constEnd() && entry->size == size && entry->modified == modified)
+            return entry->hash;
+    }
+
     QFile file(fileName);
-    return hash(&file, type);
+    auto result = hash(&file, type);
+
+    if (!result.isEmpty() && !info.canonicalFilePath().isEmpty()) {
+        QMutexLocker locker(&s_cache_lock);
+        s_cache.insert(key, { size, modified, result });
+    }
+    return result;
 }
 
 QString hash(QByteArray data, Algorithm type)
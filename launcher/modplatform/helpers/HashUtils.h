@@ -15,6 +15,8 @@ enum class Algorithm { Md4, Md5, Sha1, Sha256, Sha512, Murmur2, Unknown };
 QString algorithmToString(Algorithm type);
 Algorithm algorithmFromString(QString type);
 QString hash(QIODevice* device, Algorithm type);
+/** Hashes the file at 'fileName'. Results are remembered for as long as the launcher runs, keyed by the canonical path,
+ *  so a file only gets read again once its size or modification time changes. */
 QString hash(QString fileName, Algorithm type);
 QString hash(QByteArray data, Algorithm type);
 
@@ -9,6 +9,7 @@
 #include "net/NetJob.h"
 
 #include "modplatform/ModIndex.h"
+#include "modplatform/helpers/SearchCache.h"
 
 #include "net/ApiDownload.h"
 
@@ -22,12 +23,21 @@ Task::Ptr NetworkResourceAPI::searchProjects(SearchArgs&& args, SearchCallbacks&
 
     auto search_url = search_url_optional.value();
 
+    // Pages we've seen recently don't need to be downloaded again
+    if (auto page = SearchCache::instance().page(search_url, SearchCache::s_page_ttl); page.has_value()) {
+        auto doc = QJsonDocument::fromJson(*page);
+        if (!doc.isNull()) {
+            callbacks.on_succeed(doc);
+            return nullptr;
+        }
+    }
+
     auto response = std::make_shared<QByteArray>();
     auto netJob = makeShared<NetJob>(QString("%1::Search").arg(debugName()), APPLICATION->network());
 
     netJob->addNetAction(Net::ApiDownload::makeByteArray(QUrl(search_url), response));
 
-    QObject::connect(netJob.get(), &NetJob::succeeded, [this, response, callbacks] {
+    QObject::connect(netJob.get(), &NetJob::succeeded, [this, response, callbacks, search_url] {
         QJsonParseError parse_error{};
         QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
         if (parse_error.error != QJsonParseError::NoError) {
@@ -40,6 +50,7 @@ Task::Ptr NetworkResourceAPI::searchProjects(SearchArgs&& args, SearchCallbacks&
             return;
         }
 
+        SearchCache::instance().storePage(search_url, *response);
         callbacks.on_succeed(doc);
     });
 
@@ -47,12 +58,23 @@ Task::Ptr NetworkResourceAPI::searchProjects(SearchArgs&& args, SearchCallbacks&
     // This prevents the lambda from extending the lifetime of the shared resource,
     // as it only temporarily locks the resource when needed.
     auto weak = netJob.toWeakRef();
-    QObject::connect(netJob.get(), &NetJob::failed, [weak, callbacks](const QString& reason) {
+    QObject::connect(netJob.get(), &NetJob::failed, [this, weak, callbacks, search_url](const QString& reason) {
         int network_error_code = -1;
         if (auto netJob = weak.lock()) {
             if (auto* failed_action = netJob->getFailedActions().at(0); failed_action)
                 network_error_code = failed_action->replyStatusCode();
         }
+
+        // Older results beat no results when we're offline, but an outdated API (409) has to be reported
+        if (network_error_code != 409) {
+            if (auto page = SearchCache::instance().page(search_url, SearchCache::s_offline_ttl); page.has_value()) {
+                if (auto doc = QJsonDocument::fromJson(*page); !doc.isNull()) {
+                    qWarning() << "Search in" << debugName() << "failed, showing older results instead:" << reason;
+                    callbacks.on_succeed(doc);
+                    return;
+                }
+            }
+        }
         callbacks.on_fail(reason, network_error_code);
     });
     QObject::connect(netJob.get(), &NetJob::aborted, [callbacks] { callbacks.on_abort(); });
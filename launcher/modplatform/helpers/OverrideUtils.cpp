@@ -1,11 +1,18 @@
 #include "OverrideUtils.h"
 
 #include <QDirIterator>
+#include <QSet>
 
 #include "FileSystem.h"
+#include "modplatform/helpers/HashUtils.h"
 
 namespace Override {
 
+static QString hashesFileName(const QString& name)
+{
+    return name + "-hashes.txt";
+}
+
 void createOverrides(const QString& name, const QString& parent_folder, const QString& override_path)
 {
     QString file_path(FS::PathCombine(parent_folder, name + ".txt"));
@@ -17,20 +24,32 @@ void createOverrides(const QString& name, const QString& parent_folder, const QS
     QFile file(file_path);
     file.open(QFile::WriteOnly);
 
+    QFile hashes_file(FS::PathCombine(parent_folder, hashesFileName(name)));
+    hashes_file.open(QFile::WriteOnly | QFile::Truncate);
+
+    QDir override_dir(override_path);
     QDirIterator override_iterator(override_path, QDirIterator::Subdirectories);
     while (override_iterator.hasNext()) {
         auto override_file_path = override_iterator.next();
         QFileInfo info(override_file_path);
         if (info.isFile()) {
+            auto hash = Hashing::hash(override_file_path, Hashing::Algorithm::Sha1);
+
             // Absolute path with temp directory -> relative path
             override_file_path = override_file_path.split(name).last().remove(0, 1);
 
             file.write(override_file_path.toUtf8());
             file.write("\n");
+
+            hashes_file.write(hash.toUtf8());
+            hashes_file.write(" ");
+            hashes_file.write(override_dir.relativeFilePath(info.filePath()).toUtf8());
+            hashes_file.write("\n");
         }
     }
 
     file.close();
+    hashes_file.close();
 }
 
 QStringList readOverrides(const QString& name, const QString& parent_folder)
@@ -56,4 +75,83 @@ QStringList readOverrides(const QString& name, const QString& parent_folder)
     return previous_overrides;
 }
 
+QHash<QString, QString> readOverrideHashes(const QString& name, const QString& parent_folder)
+{
+    QFile file(FS::PathCombine(parent_folder, hashesFileName(name)));
+    if (!file.open(QFile::ReadOnly))
+        return {};
+
+    QHash<QString, QString> hashes;
+    while (!file.atEnd()) {
+        // <sha1> <relative path>
+        auto line = QString::fromUtf8(file.readLine()).trimmed();
+        auto separator = line.indexOf(' ');
+        if (separator <= 0)
+            continue;
+        hashes.insert(line.mid(separator + 1), line.left(separator));
+    }
+
+    return hashes;
+}
+
+Diff diffOverrides(const QString& name, const QString& old_parent_folder, const QString& old_root, const QString& override_path)
+{
+    Diff diff;
+
+    auto old_hashes = readOverrideHashes(name, old_parent_folder);
+    QDir old_root_dir(old_root);
+
+    // Whether the installed file was changed since the pack put it there.
+    // Packs installed before we kept hashes can't tell, so we treat everything as untouched, like we used to.
+    auto userEdited = [&old_hashes](const QString& relative_path, const QString& disk_hash) {
+        auto old_hash = old_hashes.constFind(relative_path);
+        return old_hash != old_hashes.constEnd() && *old_hash != disk_hash;
+    };
+
+    QSet<QString> new_overrides;
+    QDir override_dir(override_path);
+    QDirIterator override_iterator(override_path, QDir::Files | QDir::Hidden, QDirIterator::Subdirectories);
+    while (!override_path.isEmpty() && override_iterator.hasNext()) {
+        auto new_file_path = override_iterator.next();
+        auto relative_path = override_dir.relativeFilePath(new_file_path);
+        new_overrides.insert(relative_path);
+
+        auto installed_path = old_root_dir.absoluteFilePath(relative_path);
+        if (!QFileInfo::exists(installed_path))
+            continue;
+
+        auto disk_hash = Hashing::hash(installed_path, Hashing::Algorithm::Sha1);
+        if (disk_hash == Hashing::hash(new_file_path, Hashing::Algorithm::Sha1)) {
+            diff.to_keep.append(relative_path);
+        } else if (userEdited(relative_path, disk_hash)) {
+            qDebug() << "Keeping user edited override" << relative_path;
+            diff.to_keep.append(relative_path);
+        }
+    }
+
+    for (const auto& entry : readOverrides(name, old_parent_folder)) {
+        if (entry.isEmpty() || new_overrides.contains(entry))
+            continue;
+
+        auto installed_path = old_root_dir.absoluteFilePath(entry);
+        if (QFileInfo::exists(installed_path) && userEdited(entry, Hashing::hash(installed_path, Hashing::Algorithm::Sha1))) {
+            qDebug() << "Keeping user edited override" << entry << "which is no longer part of the pack";
+            continue;
+        }
+
+        diff.to_remove.append(entry);
+    }
+
+    return diff;
+}
+
+void skipOverrides(const QString& override_path, const QStringList& skipped)
+{
+    auto prefix = QDir(override_path).absolutePath() + '/';
+    for (const auto& path : skipped) {
+        if (path.startsWith(prefix))
+            QFile::remove(path);
+    }
+}
+
 }  // namespace Override
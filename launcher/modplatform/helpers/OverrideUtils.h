@@ -1,11 +1,13 @@
 #pragma once
 
+#include <QHash>
 #include <QString>
+#include <QStringList>
 
 namespace Override {
 
 /** This creates a file in `parent_folder` that holds information about which
- *  overrides are in `override_path`.
+ *  overrides are in `override_path`, along with another one holding their hashes.
  *
  *  If there's already an existing such file, it will be ovewritten.
  */
@@ -17,4 +19,28 @@ void createOverrides(const QString& name, const QString& parent_folder, const QS
  */
 QStringList readOverrides(const QString& name, const QString& parent_folder);
 
+/** This reads the hashes of the overrides as they were shipped by the pack, keyed by their relative path.
+ *
+ *  If there's no such file in `parent_folder` (i.e. the pack was installed by an older version), it will return an empty hash.
+ */
+QHash<QString, QString> readOverrideHashes(const QString& name, const QString& parent_folder);
+
+struct Diff {
+    /** Old overrides that aren't part of the pack anymore, relative to the game root. */
+    QStringList to_remove;
+    /** New overrides that must not be applied, because the installed file is identical or was edited by the user. */
+    QStringList to_keep;
+};
+
+/** Compares the overrides of the installed version (as recorded in `old_parent_folder`) with the new ones in `override_path`,
+ *  taking into account what is actually on disk in `old_root`.
+ *
+ *  Files the user changed since they were installed are never removed nor replaced.
+ *  An empty `override_path` means the new version has no overrides.
+ */
+Diff diffOverrides(const QString& name, const QString& old_parent_folder, const QString& old_root, const QString& override_path);
+
+/** Deletes the entries of `skipped` which are inside `override_path`, so that they aren't applied over the instance. */
+void skipOverrides(const QString& override_path, const QStringList& skipped);
+
 }  // namespace Override
@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "SearchCache.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QRegularExpression>
+
+#include <algorithm>
+
+#include "Application.h"
+#include "FileSystem.h"
+
+// A page of results is somewhere around 50 KiB, so this is a few hundred of them
+static constexpr int s_memory_budget_kib = 16 * 1024;
+
+SearchCache& SearchCache::instance()
+{
+    // in tests the application macro doesn't work, so keep it in memory only
+    static SearchCache s_instance(APPLICATION_DYN ? FS::PathCombine(APPLICATION->dataRoot(), "cache", "search") : QString());
+    return s_instance;
+}
+
+SearchCache::SearchCache(QString disk_dir) : m_disk_dir(std::move(disk_dir))
+{
+    m_pages.setMaxCost(s_memory_budget_kib);
+    pruneDisk();
+}
+
+QString SearchCache::pagePath(const QString& url) const
+{
+    return FS::PathCombine(m_disk_dir, QCryptographicHash::hash(url.toUtf8(), QCryptographicHash::Sha1).toHex() + ".json");
+}
+
+std::optional<QByteArray> SearchCache::page(const QString& url, std::chrono::seconds max_age)
+{
+    auto now = QDateTime::currentDateTimeUtc();
+    if (auto* cached = m_pages.object(url); cached && cached->fetched.secsTo(now) <= max_age.count())
+        return cached->data;
+
+    if (m_disk_dir.isEmpty())
+        return {};
+
+    QFileInfo info(pagePath(url));
+    if (!info.exists() || info.lastModified().secsTo(now) > max_age.count())
+        return {};
+
+    QFile file(info.absoluteFilePath());
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+    auto data = file.readAll();
+
+    m_pages.insert(url, new Page{ data, info.lastModified().toUTC() }, std::max(1, static_cast<int>(data.size() / 1024)));
+    return data;
+}
+
+void SearchCache::storePage(const QString& url, const QByteArray& data)
+{
+    m_pages.insert(url, new Page{ data, QDateTime::currentDateTimeUtc() }, std::max(1, static_cast<int>(data.size() / 1024)));
+
+    if (m_disk_dir.isEmpty())
+        return;
+
+    try {
+        FS::write(pagePath(url), data);
+    } catch (const Exception& e) {
+        qWarning() << "Could not store search results on disk:" << e.cause();
+    }
+}
+
+void SearchCache::pruneDisk()
+{
+    if (m_disk_dir.isEmpty())
+        return;
+
+    auto now = QDateTime::currentDateTimeUtc();
+    for (auto& info : QDir(m_disk_dir).entryInfoList({ "*.json" }, QDir::Files)) {
+        if (info.lastModified().secsTo(now) > s_offline_ttl.count())
+            QFile::remove(info.absoluteFilePath());
+    }
+}
+
+QStringList SearchCache::tokenize(const QString& text)
+{
+    static const QRegularExpression s_separators("[^\\p{L}\\p{N}]+");
+    return text.toLower().split(s_separators, Qt::SkipEmptyParts);
+}
+
+void SearchCache::removeEntry(Scope& scope, const QString& id)
+{
+    auto entry = scope.entries.find(id);
+    if (entry == scope.entries.end())
+        return;
+
+    for (auto& token : entry->tokens) {
+        auto word = scope.words.find(token);
+        if (word == scope.words.end())
+            continue;
+        word->remove(id);
+        if (word->isEmpty())
+            scope.words.erase(word);
+    }
+    scope.entries.erase(entry);
+}
+
+void SearchCache::insertPacks(const QString& scope_name, const QList<ModPlatform::IndexedPack::Ptr>& packs, QDateTime seen)
+{
+    auto& scope = m_scopes[scope_name];
+
+    for (auto& pack : packs) {
+        auto id = pack->addonId.toString();
+        if (id.isEmpty())
+            continue;
+        removeEntry(scope, id);
+
+        // Versions and extra info belong to whoever loaded them, and get loaded again for each search anyway
+        auto copy = std::make_shared<ModPlatform::IndexedPack>();
+        copy->addonId = pack->addonId;
+        copy->provider = pack->provider;
+        copy->name = pack->name;
+        copy->slug = pack->slug;
+        copy->description = pack->description;
+        copy->authors = pack->authors;
+        copy->logoName = pack->logoName;
+        copy->logoUrl = pack->logoUrl;
+        copy->websiteUrl = pack->websiteUrl;
+        copy->side = pack->side;
+
+        QString text = pack->name + ' ' + pack->slug + ' ' + pack->description;
+        for (auto& author : pack->authors)
+            text += ' ' + author.name;
+        auto tokens = tokenize(text);
+        tokens.removeDuplicates();
+
+        for (auto& token : tokens)
+            scope.words[token].insert(id);
+        scope.entries.insert(id, { copy, tokens, seen });
+    }
+}
+
+QList<ModPlatform::IndexedPack::Ptr> SearchCache::findPacks(const QString& scope_name, const QString& term, int limit, QDateTime now) const
+{
+    auto scope = m_scopes.constFind(scope_name);
+    if (scope == m_scopes.constEnd())
+        return {};
+
+    auto words = tokenize(term);
+    if (words.isEmpty())
+        return {};
+
+    std::optional<QSet<QString>> matches;
+    for (auto& word : words) {
+        QSet<QString> ids;
+        for (auto it = scope->words.lowerBound(word); it != scope->words.constEnd() && it.key().startsWith(word); ++it)
+            ids.unite(it.value());
+
+        if (matches.has_value())
+            matches->intersect(ids);
+        else
+            matches = ids;
+
+        if (matches->isEmpty())
+            return {};
+    }
+
+    QList<ModPlatform::IndexedPack::Ptr> results;
+    for (auto& id : *matches) {
+        auto entry = scope->entries.value(id);
+        if (entry.seen.secsTo(now) > s_pack_ttl.count())
+            continue;
+        // Copies, since models fill in versions and such on the packs they show
+        results.append(std::make_shared<ModPlatform::IndexedPack>(*entry.pack));
+    }
+
+    auto prefix = term.trimmed().toLower();
+    std::sort(results.begin(), results.end(), [&prefix](const ModPlatform::IndexedPack::Ptr& a, const ModPlatform::IndexedPack::Ptr& b) {
+        bool a_prefixed = a->name.toLower().startsWith(prefix);
+        bool b_prefixed = b->name.toLower().startsWith(prefix);
+        if (a_prefixed != b_prefixed)
+            return a_prefixed;
+        return a->name.compare(b->name, Qt::CaseInsensitive) < 0;
+    });
+
+    return results.mid(0, limit);
+}
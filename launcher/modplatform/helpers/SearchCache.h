@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QByteArray>
+#include <QCache>
+#include <QDateTime>
+#include <QHash>
+#include <QMap>
+#include <QSet>
+#include <QString>
+
+#include <chrono>
+#include <optional>
+
+#include "modplatform/ModIndex.h"
+
+/** What the launcher already got back from searching the mod platforms.
+ *
+ *  Raw search result pages are kept by URL, in memory and on disk, so browsing the same pages again doesn't download
+ *  them again, and so they can still be shown while offline. The packs in those pages are also indexed by the words in
+ *  their name, slug, description and authors, which lets a new search term show local matches right away while the
+ *  real search is still running. Only meant to be used from the GUI thread.
+ */
+class SearchCache {
+   public:
+    // How long a page gets served without asking the API again
+    static constexpr std::chrono::seconds s_page_ttl = std::chrono::minutes(10);
+    // How old a page can get and still be used when the API can't be reached
+    static constexpr std::chrono::seconds s_offline_ttl = std::chrono::hours(24 * 7);
+    // How long a pack stays in the local index after it was last seen in a result
+    static constexpr std::chrono::seconds s_pack_ttl = std::chrono::hours(24);
+
+    static SearchCache& instance();
+
+    /** 'disk_dir' can be empty to keep everything in memory only. */
+    explicit SearchCache(QString disk_dir);
+
+    /** Returns the page fetched from 'url', if there is one younger than 'max_age'. */
+    std::optional<QByteArray> page(const QString& url, std::chrono::seconds max_age);
+    void storePage(const QString& url, const QByteArray& data);
+
+    /** Adds 'packs' to the index of 'scope', which separates packs that can't show up in the same search, like mods
+     *  and resource packs, or mods for different loaders. Only the basic info of a pack is kept, not its versions. */
+    void insertPacks(const QString& scope, const QList<ModPlatform::IndexedPack::Ptr>& packs, QDateTime seen = QDateTime::currentDateTimeUtc());
+
+    /** Returns up to 'limit' indexed packs of 'scope' which have a word starting with each of the words in 'term'.
+     *  Packs whose name starts with the term come first. */
+    QList<ModPlatform::IndexedPack::Ptr> findPacks(const QString& scope,
+                                                   const QString& term,
+                                                   int limit,
+                                                   QDateTime now = QDateTime::currentDateTimeUtc()) const;
+
+    static QStringList tokenize(const QString& text);
+
+   private:
+    struct Page {
+        QByteArray data;
+        QDateTime fetched;
+    };
+
+    struct Entry {
+        ModPlatform::IndexedPack::Ptr pack;
+        QStringList tokens;
+        QDateTime seen;
+    };
+
+    struct Scope {
+        QHash<QString, Entry> entries;
+        // Word -> IDs of the packs having it, sorted so that all words with a given prefix are next to each other
+        QMap<QString, QSet<QString>> words;
+    };
+
+    QString pagePath(const QString& url) const;
+    void removeEntry(Scope& scope, const QString& id);
+    void pruneDisk();
+
+    QString m_disk_dir;
+    QCache<QString, Page> m_pages;
+    QHash<QString, Scope> m_scopes;
+};
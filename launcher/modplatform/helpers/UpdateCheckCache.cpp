@@ -0,0 +1,65 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateCheckCache.h"
+
+UpdateCheckCache& UpdateCheckCache::instance()
+{
+    static UpdateCheckCache s_instance;
+    return s_instance;
+}
+
+QString UpdateCheckCache::key(ModPlatform::ResourceProvider provider, const QString& id, const QString& context)
+{
+    return QString("%1|%2|%3").arg(static_cast<int>(provider)).arg(id, context);
+}
+
+std::optional<QJsonValue> UpdateCheckCache::find(ModPlatform::ResourceProvider provider,
+                                                 const QString& id,
+                                                 const QString& context,
+                                                 QDateTime now)
+{
+    auto answer = m_answers.constFind(key(provider, id, context));
+    if (answer == m_answers.constEnd() || answer->fetched.secsTo(now) > s_ttl.count())
+        return {};
+    return answer->value;
+}
+
+void UpdateCheckCache::insert(ModPlatform::ResourceProvider provider,
+                              const QString& id,
+                              const QString& context,
+                              const QJsonValue& answer,
+                              QDateTime now)
+{
+    prune(now);
+    m_answers.insert(key(provider, id, context), { answer, now });
+}
+
+void UpdateCheckCache::prune(const QDateTime& now)
+{
+    // Expired answers are never used again, so throw them out every now and then instead of letting them pile up
+    if (m_last_prune.isValid() && m_last_prune.secsTo(now) < s_ttl.count())
+        return;
+    m_last_prune = now;
+
+    for (auto it = m_answers.begin(); it != m_answers.end();) {
+        if (it->fetched.secsTo(now) > s_ttl.count())
+            it = m_answers.erase(it);
+        else
+            ++it;
+    }
+}
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QDateTime>
+#include <QHash>
+#include <QJsonValue>
+#include <QString>
+
+#include <chrono>
+#include <optional>
+
+#include "modplatform/ModIndex.h"
+
+/** What the update checks learned from the mod platforms, shared by the checks of every resource page.
+ *
+ *  Each answer is kept under the provider, the thing that was asked about (a file hash or a project ID) and what else
+ *  went into the question, like the game version and mod loader. Checking another page of the same instance, or the
+ *  same page again, then only asks the API about what it hasn't been asked about yet. Answers that nothing was found
+ *  are kept as well. Only meant to be used from the GUI thread.
+ */
+class UpdateCheckCache {
+   public:
+    // How long an answer gets used without asking the API again
+    static constexpr std::chrono::seconds s_ttl = std::chrono::minutes(10);
+
+    static UpdateCheckCache& instance();
+
+    /** Returns the answer stored for 'id' in 'context', if there is one younger than s_ttl. */
+    std::optional<QJsonValue> find(ModPlatform::ResourceProvider provider,
+                                   const QString& id,
+                                   const QString& context,
+                                   QDateTime now = QDateTime::currentDateTimeUtc());
+    void insert(ModPlatform::ResourceProvider provider,
+                const QString& id,
+                const QString& context,
+                const QJsonValue& answer,
+                QDateTime now = QDateTime::currentDateTimeUtc());
+
+   private:
+    struct Answer {
+        QJsonValue value;
+        QDateTime fetched;
+    };
+
+    static QString key(ModPlatform::ResourceProvider provider, const QString& id, const QString& context);
+    void prune(const QDateTime& now);
+
+    QHash<QString, Answer> m_answers;
+    QDateTime m_last_prune;
+};
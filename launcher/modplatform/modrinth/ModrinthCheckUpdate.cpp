@@ -9,6 +9,7 @@
 #include "ResourceDownloadTask.h"
 
 #include "modplatform/helpers/HashUtils.h"
+#include "modplatform/helpers/UpdateCheckCache.h"
 
 #include "tasks/ConcurrentTask.h"
 
@@ -59,11 +60,32 @@ void ModrinthCheckUpdate::getUpdateModsForLoader(std::optional<ModPlatform::ModL
     setStatus(tr("Waiting for the API response from Modrinth..."));
     setProgress(m_progress + 1, m_progressTotal);
 
-    auto response = std::make_shared<QByteArray>();
-    QStringList hashes = m_mappings.keys();
-    auto job = api.latestVersions(hashes, m_hash_type, m_game_versions, loader, response);
+    // Hashes that some page already asked about don't need asking again
+    auto context = cacheContext(loader);
+    QJsonObject known;
+    QStringList hashes;
+    for (auto it = m_mappings.constBegin(); it != m_mappings.constEnd(); ++it) {
+        if (auto answer = UpdateCheckCache::instance().find(ModPlatform::ResourceProvider::MODRINTH, it.key(), context))
+            known.insert(it.key(), *answer);
+        else
+            hashes.append(it.key());
+    }
+    if (hashes.isEmpty()) {
+        checkVersions(known, loader);
+        return;
+    }
+
+    // One request per batch of hashes rather than per resource, with the batches going out side by side
+    auto job = makeShared<ConcurrentTask>("ModrinthLatestVersionsTask", APPLICATION->settings()->get("NumberOfConcurrentTasks").toInt());
+    QList<std::shared_ptr<QByteArray>> responses;
+    for (qsizetype i = 0; i < hashes.size(); i += s_max_hashes_per_request) {
+        auto response = std::make_shared<QByteArray>();
+        job->addTask(api.latestVersions(hashes.mid(i, s_max_hashes_per_request), m_hash_type, m_game_versions, loader, response));
+        responses.append(response);
+    }
 
-    connect(job.get(), &Task::succeeded, this, [this, response, loader] { checkVersionsResponse(response, loader); });
+    connect(job.get(), &Task::succeeded, this,
+            [this, responses, hashes, known, loader] { checkVersionsResponse(responses, hashes, known, loader); });
 
     connect(job.get(), &Task::failed, this, &ModrinthCheckUpdate::checkNextLoader);
 
@@ -71,22 +93,50 @@ void ModrinthCheckUpdate::getUpdateModsForLoader(std::optional<ModPlatform::ModL
     job->start();
 }
 
-void ModrinthCheckUpdate::checkVersionsResponse(std::shared_ptr<QByteArray> response, std::optional<ModPlatform::ModLoaderTypes> loader)
+QString ModrinthCheckUpdate::cacheContext(std::optional<ModPlatform::ModLoaderTypes> loader) const
 {
-    setStatus(tr("Parsing the API response from Modrinth..."));
-    setProgress(m_progress + 1, m_progressTotal);
+    QStringList game_versions;
+    for (auto& version : m_game_versions)
+        game_versions.append(version.toString());
+    auto loaders = loader.has_value() ? QString::number(static_cast<int>(*loader)) : QString();
+    return QString("%1|%2|%3").arg(m_hash_type, game_versions.join(','), loaders);
+}
 
-    QJsonParseError parse_error{};
-    QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
-    if (parse_error.error != QJsonParseError::NoError) {
-        qWarning() << "Error while parsing JSON response from ModrinthCheckUpdate at " << parse_error.offset
-                   << " reason: " << parse_error.errorString();
-        qWarning() << *response;
+void ModrinthCheckUpdate::checkVersionsResponse(QList<std::shared_ptr<QByteArray>> responses,
+                                                QStringList hashes,
+                                                QJsonObject versions,
+                                                std::optional<ModPlatform::ModLoaderTypes> loader)
+{
+    for (auto& response : responses) {
+        QJsonParseError parse_error{};
+        QJsonDocument doc = QJsonDocument::fromJson(*response, &parse_error);
+        if (parse_error.error != QJsonParseError::NoError) {
+            qWarning() << "Error while parsing JSON response from ModrinthCheckUpdate at " << parse_error.offset
+                       << " reason: " << parse_error.errorString();
+            qWarning() << *response;
+
+            emitFailed(parse_error.errorString());
+            return;
+        }
 
-        emitFailed(parse_error.errorString());
-        return;
+        auto batch = doc.object();
+        for (auto it = batch.constBegin(); it != batch.constEnd(); ++it)
+            versions.insert(it.key(), it.value());
     }
 
+    // Hashes the API had nothing for are left out of its answer, and that is worth remembering too
+    auto context = cacheContext(loader);
+    for (auto& hash : hashes)
+        UpdateCheckCache::instance().insert(ModPlatform::ResourceProvider::MODRINTH, hash, context, versions.value(hash).toObject());
+
+    checkVersions(versions, loader);
+}
+
+void ModrinthCheckUpdate::checkVersions(const QJsonObject& versions, std::optional<ModPlatform::ModLoaderTypes> loader)
+{
+    setStatus(tr("Parsing the API response from Modrinth..."));
+    setProgress(m_progress + 1, m_progressTotal);
+
     try {
         auto iter = m_mappings.begin();
 
@@ -94,7 +144,7 @@ void ModrinthCheckUpdate::checkVersionsResponse(std::shared_ptr<QByteArray> resp
             const QString hash = iter.key();
             Resource* resource = iter.value();
 
-            auto project_obj = doc[hash].toObject();
+            auto project_obj = versions[hash].toObject();
 
             // If the returned project is empty, but we have Modrinth metadata,
             // it means this specific version is not available
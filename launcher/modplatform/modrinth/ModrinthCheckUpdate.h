@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QJsonObject>
+
 #include "modplatform/CheckUpdateTask.h"
 
 class ModrinthCheckUpdate : public CheckUpdateTask {
@@ -20,10 +22,20 @@ class ModrinthCheckUpdate : public CheckUpdateTask {
    protected slots:
     void executeTask() override;
     void getUpdateModsForLoader(std::optional<ModPlatform::ModLoaderTypes> loader);
-    void checkVersionsResponse(std::shared_ptr<QByteArray> response, std::optional<ModPlatform::ModLoaderTypes> loader);
+    void checkVersionsResponse(QList<std::shared_ptr<QByteArray>> responses,
+                               QStringList hashes,
+                               QJsonObject versions,
+                               std::optional<ModPlatform::ModLoaderTypes> loader);
+    void checkVersions(const QJsonObject& versions, std::optional<ModPlatform::ModLoaderTypes> loader);
     void checkNextLoader();
 
    private:
+    // What, besides the hash, goes into an answer of the API
+    QString cacheContext(std::optional<ModPlatform::ModLoaderTypes> loader) const;
+
+    // How many hashes go into a single request to /version_files/update
+    static constexpr qsizetype s_max_hashes_per_request = 500;
+
     Task::Ptr m_job = nullptr;
     QHash<QString, Resource*> m_mappings;
     QString m_hash_type;
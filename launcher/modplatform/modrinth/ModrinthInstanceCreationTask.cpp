@@ -19,6 +19,8 @@
 #include "net/ApiDownload.h"
 #include "net/NetJob.h"
 #include "settings/INISettingsObject.h"
+#include "tasks/ConcurrentTask.h"
+#include "tasks/MultipleOptionsTask.h"
 
 #include "ui/dialogs/CustomMessageBox.h"
 #include "ui/pages/modplatform/OptionalModDialog.h"
@@ -36,6 +38,8 @@ bool ModrinthCreationTask::abort()
     m_abort = true;
     if (m_task)
         m_task->abort();
+    if (m_metadata_task)
+        m_metadata_task->abort();
     return Task::abort();
 }
 
@@ -88,56 +92,56 @@ bool ModrinthCreationTask::updateInstance()
         std::vector<Modrinth::File> old_files;
         parseManifest(old_index_path, old_files, false, false);
 
-        // Let's remove all duplicated, identical resources!
+        QDir old_minecraft_dir(inst->gameRoot());
+
+        // Let's remove all identical resources that are still where the old version put them!
+        QHash<QString, QByteArray> old_hashes;
+        for (auto const& old_file : old_files)
+            old_hashes.insert(old_file.path, old_file.hash);
+
         auto files_iterator = m_files.begin();
-    begin:
         while (files_iterator != m_files.end()) {
             auto const& file = *files_iterator;
 
-            auto old_files_iterator = old_files.begin();
-            while (old_files_iterator != old_files.end()) {
-                auto const& old_file = *old_files_iterator;
-
-                if (old_file.hash == file.hash) {
+            auto old_hash = old_hashes.constFind(file.path);
+            if (old_hash != old_hashes.constEnd() && *old_hash == file.hash) {
+                auto installed_path = old_minecraft_dir.absoluteFilePath(file.path);
+                // the user may have disabled it in the meantime, that's fine too
+                if (QFileInfo::exists(installed_path) || QFileInfo::exists(installed_path + ".disabled")) {
                     qDebug() << "Removed file at" << file.path << "from list of downloads";
+                    old_hashes.remove(file.path);
                     files_iterator = m_files.erase(files_iterator);
-                    old_files_iterator = old_files.erase(old_files_iterator);
-                    goto begin;  // Sorry :c
+                    continue;
                 }
-
-                old_files_iterator++;
             }
 
             files_iterator++;
         }
 
-        QDir old_minecraft_dir(inst->gameRoot());
-
         // Some files were removed from the old version, and some will be downloaded in an updated version,
         // so we're fine removing them!
-        if (!old_files.empty()) {
-            for (auto const& file : old_files) {
-                if (file.path.isEmpty())
-                    continue;
-                qDebug() << "Scheduling" << file.path << "for removal";
-                m_files_to_remove.append(old_minecraft_dir.absoluteFilePath(file.path));
-            }
+        for (auto it = old_hashes.constBegin(); it != old_hashes.constEnd(); ++it) {
+            if (it.key().isEmpty())
+                continue;
+            qDebug() << "Scheduling" << it.key() << "for removal";
+            m_files_to_remove.append(old_minecraft_dir.absoluteFilePath(it.key()));
         }
 
-        // We will remove all the previous overrides, to prevent duplicate files!
-        // TODO: Currently 'overrides' will always override the stuff on update. How do we preserve unchanged overrides?
+        // Only touch the overrides that changed, and leave alone the ones the user edited.
         // FIXME: We may want to do something about disabled mods.
-        auto old_overrides = Override::readOverrides("overrides", old_index_folder);
-        for (const auto& entry : old_overrides) {
-            if (entry.isEmpty())
-                continue;
-            qDebug() << "Scheduling" << entry << "for removal";
-            m_files_to_remove.append(old_minecraft_dir.absoluteFilePath(entry));
+        QStringList kept_overrides;
+        QStringList removed_overrides;
+        for (QString overrides_name : { "overrides", "client-overrides" }) {
+            QDir staged_overrides(FS::PathCombine(m_stagingPath, overrides_name));
+            auto diff = Override::diffOverrides(overrides_name, old_index_folder, inst->gameRoot(), staged_overrides.absolutePath());
+            for (const auto& entry : diff.to_keep)
+                m_overrides_to_skip.append(staged_overrides.absoluteFilePath(entry));
+            kept_overrides.append(diff.to_keep);
+            removed_overrides.append(diff.to_remove);
         }
-
-        auto old_client_overrides = Override::readOverrides("client-overrides", old_index_folder);
-        for (const auto& entry : old_client_overrides) {
-            if (entry.isEmpty())
+        for (const auto& entry : removed_overrides) {
+            // it may have just moved from the client overrides to the common ones, or vice versa
+            if (kept_overrides.contains(entry))
                 continue;
             qDebug() << "Scheduling" << entry << "for removal";
             m_files_to_remove.append(old_minecraft_dir.absoluteFilePath(entry));
@@ -167,8 +171,6 @@ bool ModrinthCreationTask::updateInstance()
 // https://docs.modrinth.com/docs/modpacks/format_definition/
 bool ModrinthCreationTask::createInstance()
 {
-    QEventLoop loop;
-
     QString parent_folder(FS::PathCombine(m_stagingPath, "mrpack"));
 
     QString index_path = FS::PathCombine(m_stagingPath, "modrinth.index.json");
@@ -186,6 +188,7 @@ bool ModrinthCreationTask::createInstance()
     if (QFile::exists(override_path)) {
         // Create a list of overrides in "overrides.txt" inside mrpack/
         Override::createOverrides("overrides", parent_folder, override_path);
+        Override::skipOverrides(override_path, m_overrides_to_skip);
 
         // Apply the overrides
         if (!FS::move(override_path, mcPath)) {
@@ -199,6 +202,7 @@ bool ModrinthCreationTask::createInstance()
     if (QFile::exists(client_override_path)) {
         // Create a list of overrides in "client-overrides.txt" inside mrpack/
         Override::createOverrides("client-overrides", parent_folder, client_override_path);
+        Override::skipOverrides(client_override_path, m_overrides_to_skip);
 
         // Apply the overrides
         if (!FS::overrideFolder(mcPath, client_override_path)) {
@@ -239,7 +243,7 @@ bool ModrinthCreationTask::createInstance()
     instance.setName(name());
     instance.saveNow();
 
-    auto downloadMods = makeShared<NetJob>(tr("Mod Download Modrinth"), APPLICATION->network());
+    auto downloadMods = makeShared<ConcurrentTask>(tr("Mod Download Modrinth"), APPLICATION->settings()->get("NumberOfConcurrentDownloads").toInt());
 
     auto root_modpack_path = FS::PathCombine(m_stagingPath, m_root_path);
     auto root_modpack_url = QUrl::fromLocalFile(root_modpack_path);
@@ -253,6 +257,9 @@ bool ModrinthCreationTask::createInstance()
             // This means we somehow got out of the root folder, so abort here to prevent exploits
             setError(tr("One of the files has a path that leads to an arbitrary location (%1). This is a security risk and isn't allowed.")
                          .arg(fileName));
+            for (auto resource : resources) {
+                delete resource;
+            }
             return false;
         }
         if (fileName.startsWith("mods/")) {
@@ -263,67 +270,63 @@ bool ModrinthCreationTask::createInstance()
             resources[file.hash.toHex()] = mod;
         }
 
+        // Try each mirror in order, until one of them gives us the right file
         qDebug() << "Will try to download" << file.downloads.front() << "to" << file_path;
-        auto dl = Net::ApiDownload::makeFile(file.downloads.dequeue(), file_path);
-        dl->addValidator(new Net::ChecksumValidator(file.hashAlgorithm, file.hash));
-        downloadMods->addNetAction(dl);
-
-        if (!file.downloads.empty()) {
-            // FIXME: This really needs to be put into a ConcurrentTask of
-            // MultipleOptionsTask's , once those exist :)
-            auto param = dl.toWeakRef();
-            connect(dl.get(), &Task::failed, [&file, file_path, param, downloadMods] {
-                auto ndl = Net::ApiDownload::makeFile(file.downloads.dequeue(), file_path);
-                ndl->addValidator(new Net::ChecksumValidator(file.hashAlgorithm, file.hash));
-                downloadMods->addNetAction(ndl);
-                if (auto shared = param.lock())
-                    shared->succeeded();
-            });
+        auto fileDownload = makeShared<MultipleOptionsTask>(tr("Download %1").arg(fileName));
+        for (auto const& url : file.downloads) {
+            auto dl = Net::ApiDownload::makeFile(url, file_path);
+            dl->addValidator(new Net::ChecksumValidator(file.hashAlgorithm, file.hash));
+
+            auto mirror = makeShared<NetJob>(fileName, APPLICATION->network(), 1);
+            mirror->setAskRetry(false);
+            mirror->addNetAction(dl);
+            fileDownload->addTask(mirror);
         }
+        downloadMods->addTask(fileDownload);
     }
 
-    bool ended_well = false;
+    // The metadata is looked up by the hashes in the index, so it doesn't need to wait for the files themselves.
+    QDir folder = FS::PathCombine(instance.modsRoot(), ".index");
+    auto ensureMetadataTask = makeShared<EnsureMetadataTask>(resources, folder, ModPlatform::ResourceProvider::MODRINTH);
 
-    connect(downloadMods.get(), &NetJob::succeeded, this, [&ended_well]() { ended_well = true; });
-    connect(downloadMods.get(), &NetJob::failed, [this, &ended_well](const QString& reason) {
+    QEventLoop loop;
+    bool ended_well = false;
+    int running = 2;
+    auto stepFinished = [&running, &loop] {
+        if (--running == 0)
+            loop.quit();
+    };
+
+    connect(downloadMods.get(), &Task::succeeded, this, [&ended_well]() { ended_well = true; });
+    connect(downloadMods.get(), &Task::failed, this, [this, &ended_well](const QString& reason) {
         ended_well = false;
         setError(reason);
     });
-    connect(downloadMods.get(), &NetJob::finished, &loop, &QEventLoop::quit);
-    connect(downloadMods.get(), &NetJob::progress, [this](qint64 current, qint64 total) {
+    connect(downloadMods.get(), &Task::finished, this, stepFinished);
+    connect(downloadMods.get(), &Task::progress, this, [this](qint64 current, qint64 total) {
         setDetails(tr("%1 out of %2 complete").arg(current).arg(total));
         setProgress(current, total);
     });
-    connect(downloadMods.get(), &NetJob::stepProgress, this, &ModrinthCreationTask::propagateStepProgress);
+    connect(downloadMods.get(), &Task::stepProgress, this, &ModrinthCreationTask::propagateStepProgress);
+
+    connect(ensureMetadataTask.get(), &Task::finished, this, stepFinished);
+    connect(ensureMetadataTask.get(), &Task::stepProgress, this, &ModrinthCreationTask::propagateStepProgress);
+    // an aborted EnsureMetadataTask doesn't report back, so don't wait for it
+    connect(this, &Task::aborted, &loop, &QEventLoop::quit);
 
     setStatus(tr("Downloading mods..."));
-    downloadMods->start();
     m_task = downloadMods;
+    m_metadata_task = ensureMetadataTask;
+    downloadMods->start();
+    ensureMetadataTask->start();
 
     loop.exec();
 
-    if (!ended_well) {
-        for (auto resource : resources) {
-            delete resource;
-        }
-        return ended_well;
-    }
-
-    QEventLoop ensureMetaLoop;
-    QDir folder = FS::PathCombine(instance.modsRoot(), ".index");
-    auto ensureMetadataTask = makeShared<EnsureMetadataTask>(resources, folder, ModPlatform::ResourceProvider::MODRINTH);
-    connect(ensureMetadataTask.get(), &Task::succeeded, this, [&ended_well]() { ended_well = true; });
-    connect(ensureMetadataTask.get(), &Task::finished, &ensureMetaLoop, &QEventLoop::quit);
-    connect(ensureMetadataTask.get(), &Task::progress, [this](qint64 current, qint64 total) {
-        setDetails(tr("%1 out of %2 complete").arg(current).arg(total));
-        setProgress(current, total);
-    });
-    connect(ensureMetadataTask.get(), &Task::stepProgress, this, &ModrinthCreationTask::propagateStepProgress);
-
-    ensureMetadataTask->start();
-    m_task = ensureMetadataTask;
-
-    ensureMetaLoop.exec();
+    // the handlers above capture this stack frame
+    downloadMods->disconnect(this);
+    ensureMetadataTask->disconnect(this);
+    m_task.reset();
+    m_metadata_task.reset();
     for (auto resource : resources) {
         delete resource;
     }
@@ -40,6 +40,7 @@ class ModrinthCreationTask final : public InstanceCreationTask {
 
     std::vector<Modrinth::File> m_files;
     Task::Ptr m_task;
+    Task::Ptr m_metadata_task;
 
     std::optional<InstancePtr> m_instance;
 
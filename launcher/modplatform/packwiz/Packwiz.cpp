@@ -19,6 +19,8 @@
 
 #include "Packwiz.h"
 
+#include <QDataStream>
+#include <QDateTime>
 #include <QDebug>
 #include <QDir>
 #include <QObject>
@@ -26,6 +28,7 @@
 #include <string>
 
 #include "FileSystem.h"
+#include "PSaveFile.h"
 #include "StringUtils.h"
 
 #include "minecraft/mod/Mod.h"
@@ -254,7 +257,7 @@ void V1::deleteModIndex(const QDir& index_dir, QString& mod_slug)
 
 void V1::deleteModIndex(const QDir& index_dir, QVariant& mod_id)
 {
-    for (auto& file_name : index_dir.entryList(QDir::Filter::Files)) {
+    for (auto& file_name : index_dir.entryList({ "*.pw.toml" }, QDir::Filter::Files)) {
         auto mod = getIndexForMod(index_dir, file_name);
 
         if (mod.mod_id() == mod_id) {
@@ -364,7 +367,7 @@ auto V1::getIndexForMod(const QDir& index_dir, QString slug) -> Mod
 
 auto V1::getIndexForMod(const QDir& index_dir, QVariant& mod_id) -> Mod
 {
-    for (auto& file_name : index_dir.entryList(QDir::Filter::Files)) {
+    for (auto& file_name : index_dir.entryList({ "*.pw.toml" }, QDir::Filter::Files)) {
         auto mod = getIndexForMod(index_dir, file_name);
 
         if (mod.mod_id() == mod_id)
@@ -374,6 +377,126 @@ auto V1::getIndexForMod(const QDir& index_dir, QVariant& mod_id) -> Mod
     return {};
 }
 
+// Binary index cache
+static const QString s_index_cache_name = "index.cache";
+static const quint32 s_index_cache_magic = 0x50574943;  // "PWIC"
+static const quint32 s_index_cache_version = 1;
+
+struct IndexCacheEntry {
+    qint64 size = -1;
+    qint64 modified = -1;
+    V1::Mod mod;
+};
+
+static QDataStream& operator<<(QDataStream& out, const V1::Mod& mod)
+{
+    out << mod.slug << mod.name << mod.filename << static_cast<qint32>(mod.side) << static_cast<qint32>(mod.loaders) << mod.mcVersions
+        << static_cast<qint32>(mod.releaseType.m_type) << mod.mode << mod.url << mod.hash_format << mod.hash
+        << static_cast<qint32>(mod.provider) << mod.file_id << mod.project_id << mod.version_number;
+    return out;
+}
+
+static QDataStream& operator>>(QDataStream& in, V1::Mod& mod)
+{
+    qint32 side, loaders, release_type, provider;
+    in >> mod.slug >> mod.name >> mod.filename >> side >> loaders >> mod.mcVersions >> release_type >> mod.mode >> mod.url >>
+        mod.hash_format >> mod.hash >> provider >> mod.file_id >> mod.project_id >> mod.version_number;
+    mod.side = static_cast<V1::Side>(side);
+    mod.loaders = ModPlatform::ModLoaderTypes(loaders);
+    mod.releaseType = ModPlatform::IndexedVersionType(static_cast<ModPlatform::IndexedVersionType::VersionType>(release_type));
+    mod.provider = static_cast<ModPlatform::ResourceProvider>(provider);
+    return in;
+}
+
+static auto readIndexCache(const QDir& index_dir) -> QHash<QString, IndexCacheEntry>
+{
+    QFile file(index_dir.absoluteFilePath(s_index_cache_name));
+    if (!file.open(QIODevice::ReadOnly))
+        return {};
+
+    // Map the whole cache, so that decoding it is a single pass over memory
+    QByteArray data;
+    if (auto mapped = file.map(0, file.size()))
+        data = QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), file.size());
+    else
+        data = file.readAll();
+
+    QDataStream in(data);
+    in.setVersion(QDataStream::Qt_5_12);
+
+    quint32 magic, version, count;
+    in >> magic >> version >> count;
+    if (in.status() != QDataStream::Ok || magic != s_index_cache_magic || version != s_index_cache_version)
+        return {};
+
+    QHash<QString, IndexCacheEntry> entries;
+    entries.reserve(count);
+    for (quint32 i = 0; i < count; i++) {
+        QString file_name;
+        IndexCacheEntry entry;
+        in >> file_name >> entry.size >> entry.modified >> entry.mod;
+        if (in.status() != QDataStream::Ok) {
+            qWarning() << "Mod metadata cache in" << index_dir.absolutePath() << "is corrupted, rebuilding it";
+            return {};
+        }
+        entries.insert(file_name, entry);
+    }
+
+    return entries;
+}
+
+static void writeIndexCache(const QDir& index_dir, const QHash<QString, IndexCacheEntry>& entries)
+{
+    PSaveFile file(index_dir.absoluteFilePath(s_index_cache_name));
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "Could not write mod metadata cache in" << index_dir.absolutePath() << ":" << file.errorString();
+        return;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_12);
+    out << s_index_cache_magic << s_index_cache_version << static_cast<quint32>(entries.size());
+    for (auto it = entries.constBegin(); it != entries.constEnd(); ++it)
+        out << it.key() << it->size << it->modified << it->mod;
+
+    if (!file.commit())
+        qWarning() << "Could not write mod metadata cache in" << index_dir.absolutePath() << ":" << file.errorString();
+}
+
+auto V1::getAllIndexes(const QDir& index_dir, bool use_cache) -> QList<Mod>
+{
+    auto cache = use_cache ? readIndexCache(index_dir) : QHash<QString, IndexCacheEntry>{};
+
+    QList<Mod> mods;
+    QHash<QString, IndexCacheEntry> entries;
+    bool changed = false;
+    for (auto const& info : index_dir.entryInfoList({ "*.pw.toml" }, QDir::Files)) {
+        auto file_name = info.fileName();
+        auto size = info.size();
+        auto modified = info.lastModified().toMSecsSinceEpoch();
+
+        IndexCacheEntry entry;
+        auto cached = cache.constFind(file_name);
+        if (cached != cache.constEnd() && cached->size == size && cached->modified == modified) {
+            entry = *cached;
+        } else {
+            // New or changed since we last saw it, go through the TOML
+            entry = { size, modified, getIndexForMod(index_dir, file_name) };
+            changed = true;
+        }
+
+        // Invalid ones are kept in the cache too, so we don't try parsing them every time
+        if (entry.mod.isValid())
+            mods.append(entry.mod);
+        entries.insert(file_name, entry);
+    }
+
+    if (use_cache && index_dir.exists() && (changed || entries.size() != cache.size()))
+        writeIndexCache(index_dir, entries);
+
+    return mods;
+}
+
 auto V1::sideToString(Side side) -> QString
 {
     switch (side) {
@@ -101,6 +101,13 @@ class V1 {
      * */
     static auto getIndexForMod(const QDir& index_dir, QVariant& mod_id) -> Mod;
 
+    /* Gets the metadata for every mod in the index folder.
+     * When using the cache, the parsed metadata is kept in a single binary file in the folder, so that only the
+     * .pw.toml files that changed since the last call need to be parsed again. The .pw.toml files stay the source
+     * of truth, so the cache can always be deleted and rebuilt from them.
+     * */
+    static auto getAllIndexes(const QDir& index_dir, bool use_cache = true) -> QList<Mod>;
+
     static auto sideToString(Side side) -> QString;
     static auto stringToSide(QString side) -> Side;
 };
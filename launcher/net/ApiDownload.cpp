@@ -24,21 +24,21 @@ namespace Net {
 
 Download::Ptr ApiDownload::makeCached(QUrl url, MetaEntryPtr entry, Download::Options options)
 {
-    auto dl = Download::makeCached(url, entry, options);
+    auto dl = Download::makeCached(applyApiUrlOverride(url), entry, options);
     dl->addHeaderProxy(new ApiHeaderProxy());
     return dl;
 }
 
 Download::Ptr ApiDownload::makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, Download::Options options)
 {
-    auto dl = Download::makeByteArray(url, output, options);
+    auto dl = Download::makeByteArray(applyApiUrlOverride(url), output, options);
     dl->addHeaderProxy(new ApiHeaderProxy());
     return dl;
 }
 
 Download::Ptr ApiDownload::makeFile(QUrl url, QString path, Download::Options options)
 {
-    auto dl = Download::makeFile(url, path, options);
+    auto dl = Download::makeFile(applyApiUrlOverride(url), path, options);
     dl->addHeaderProxy(new ApiHeaderProxy());
     return dl;
 }
@@ -46,4 +46,25 @@ class ApiHeaderProxy : public HeaderProxy {
     };
 };
 
+/** Moves requests for the Modrinth or CurseForge APIs over to the base URL set in 'ModrinthAPIURLOverride' or
+ *  'FlameAPIURLOverride', if any, so they can be answered by a local mock server instead. */
+inline QUrl applyApiUrlOverride(const QUrl& url)
+{
+    if (!APPLICATION_DYN)
+        return url;
+
+    auto url_string = url.toString();
+    const std::pair<QString, QString> overrides[] = { { "ModrinthAPIURLOverride", BuildConfig.MODRINTH_PROD_URL },
+                                                      { "FlameAPIURLOverride", BuildConfig.FLAME_BASE_URL } };
+    for (auto& [setting, base] : overrides) {
+        auto override_base = APPLICATION->settings()->get(setting).toString();
+        if (!override_base.isEmpty() && url_string.startsWith(base)) {
+            while (override_base.endsWith('/'))
+                override_base.chop(1);
+            return QUrl(override_base + url_string.mid(base.size()));
+        }
+    }
+    return url;
+}
+
 }  // namespace Net
@@ -24,7 +24,7 @@ namespace Net {
 
 Upload::Ptr ApiUpload::makeByteArray(QUrl url, std::shared_ptr<QByteArray> output, QByteArray m_post_data)
 {
-    auto up = Upload::makeByteArray(url, output, m_post_data);
+    auto up = Upload::makeByteArray(applyApiUrlOverride(url), output, m_post_data);
     up->addHeaderProxy(new ApiHeaderProxy());
     return up;
 }
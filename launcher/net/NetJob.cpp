@@ -41,6 +41,7 @@
 #include "tasks/ConcurrentTask.h"
 #if defined(LAUNCHER_APPLICATION)
 #include "Application.h"
+#include "settings/CachedSetting.h"
 #include "ui/dialogs/CustomMessageBox.h"
 #endif
 
@@ -48,8 +49,10 @@ NetJob::NetJob(QString job_name, shared_qobject_ptr<QNetworkAccessManager> netwo
     : ConcurrentTask(job_name), m_network(network)
 {
 #if defined(LAUNCHER_APPLICATION)
-    if (APPLICATION_DYN && max_concurrent < 0)
-        max_concurrent = APPLICATION->settings()->get("NumberOfConcurrentDownloads").toInt();
+    if (APPLICATION_DYN && max_concurrent < 0) {
+        static const CachedSetting<int> s_max_concurrent(APPLICATION->settings()->getSetting("NumberOfConcurrentDownloads"));
+        max_concurrent = s_max_concurrent.get();
+    }
 #endif
     if (max_concurrent > 0)
         setMaxConcurrent(max_concurrent);
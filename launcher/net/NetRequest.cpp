@@ -47,6 +47,7 @@
 
 #if defined(LAUNCHER_APPLICATION)
 #include "Application.h"
+#include "settings/CachedSetting.h"
 #endif
 #include "BuildConfig.h"
 
@@ -106,7 +107,8 @@ void NetRequest::executeTask()
 
 #if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
 #if defined(LAUNCHER_APPLICATION)
-    request.setTransferTimeout(APPLICATION->settings()->get("RequestTimeout").toInt() * 1000);
+    static const CachedSetting<int> s_timeout(APPLICATION->settings()->getSetting("RequestTimeout"));
+    request.setTransferTimeout(s_timeout.get() * 1000);
 #else
     request.setTransferTimeout();
 #endif
@@ -0,0 +1,128 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include "ThumbnailCache.h"
+
+#include <QCryptographicHash>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QImageReader>
+#include <QImageWriter>
+#include <QPainter>
+#include <QUrl>
+
+#include "FileSystem.h"
+#include "PSaveFile.h"
+
+static QString fileUri(const QFileInfo& file)
+{
+    return QString::fromUtf8(QUrl::fromLocalFile(file.absoluteFilePath()).toEncoded());
+}
+
+ThumbnailCache::ThumbnailCache(QString cache_dir, int size) : m_cache_dir(std::move(cache_dir)), m_size(size) {}
+
+QString ThumbnailCache::thumbnailPath(const QFileInfo& file) const
+{
+    auto hash = QCryptographicHash::hash(fileUri(file).toUtf8(), QCryptographicHash::Md5).toHex();
+    return FS::PathCombine(m_cache_dir, QString::fromLatin1(hash) + ".png");
+}
+
+// The text chunks come before the pixel data, so checking them never decodes an outdated thumbnail
+static bool isUpToDate(QImageReader& reader, const QFileInfo& file)
+{
+    return reader.canRead() && reader.text("Thumb::URI") == fileUri(file) &&
+           reader.text("Thumb::MTime") == QString::number(file.lastModified().toSecsSinceEpoch()) &&
+           reader.text("Thumb::Size") == QString::number(file.size());
+}
+
+bool ThumbnailCache::contains(const QFileInfo& file) const
+{
+    QImageReader reader(thumbnailPath(file), "png");
+    return isUpToDate(reader, file);
+}
+
+QImage ThumbnailCache::load(const QFileInfo& file) const
+{
+    QImageReader reader(thumbnailPath(file), "png");
+    if (!isUpToDate(reader, file))
+        return {};
+    return reader.read();
+}
+
+bool ThumbnailCache::store(const QFileInfo& file, const QImage& thumbnail) const
+{
+    auto path = thumbnailPath(file);
+    if (!FS::ensureFilePathExists(path))
+        return false;
+
+    PSaveFile output(path);
+    if (!output.open(QIODevice::WriteOnly))
+        return false;
+
+    QImageWriter writer(&output, "png");
+    writer.setText("Thumb::URI", fileUri(file));
+    writer.setText("Thumb::MTime", QString::number(file.lastModified().toSecsSinceEpoch()));
+    writer.setText("Thumb::Size", QString::number(file.size()));
+    if (!writer.write(thumbnail)) {
+        qWarning() << "Could not write the thumbnail of" << file.filePath() << ":" << writer.errorString();
+        output.cancelWriting();
+        return false;
+    }
+    return output.commit();
+}
+
+QImage ThumbnailCache::generate(const QFileInfo& file) const
+{
+    QImageReader reader(file.absoluteFilePath());
+    auto image_size = reader.size();
+    if (!image_size.isValid())
+        return {};
+
+    // Let the image plugin scale while decoding, instead of holding a full 4K image just to throw most of it away
+    reader.setScaledSize(image_size.scaled(m_size, m_size, Qt::KeepAspectRatio));
+    QImage small = reader.read();
+    if (small.isNull()) {
+        qDebug() << "Error loading screenshot" << file.filePath() << ":" << reader.errorString();
+        return {};
+    }
+
+    QPoint offset((m_size - small.width()) / 2, (m_size - small.height()) / 2);
+    QImage square(QSize(m_size, m_size), QImage::Format_ARGB32);
+    square.fill(Qt::transparent);
+
+    QPainter painter(&square);
+    painter.drawImage(offset, small);
+    painter.end();
+
+    return square;
+}
+
+void ThumbnailCache::prune(std::chrono::seconds max_age) const
+{
+    auto now = QDateTime::currentDateTimeUtc();
+    for (auto& info : QDir(m_cache_dir).entryInfoList({ "*.png" }, QDir::Files)) {
+        bool remove = info.lastModified().secsTo(now) > max_age.count();
+        if (!remove) {
+            QImageReader reader(info.absoluteFilePath(), "png");
+            auto image = QUrl::fromEncoded(reader.text("Thumb::URI").toUtf8());
+            remove = !image.isLocalFile() || !QFileInfo::exists(image.toLocalFile());
+        }
+        if (remove)
+            QFile::remove(info.absoluteFilePath());
+    }
+}
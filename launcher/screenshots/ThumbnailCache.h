@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QFileInfo>
+#include <QImage>
+#include <QString>
+
+#include <chrono>
+#include <memory>
+
+/** Screenshot thumbnails kept on disk, so they only ever get decoded from the full-size image once.
+ *
+ *  Works like the freedesktop thumbnail spec: each thumbnail is a PNG named after the MD5 of the image's URI, and
+ *  records the URI, modification time and size of the image in its text chunks. A thumbnail whose image has changed
+ *  since is simply ignored, and overwritten the next time around. Thumbnails of images that are gone, or that haven't
+ *  been written in a while, get removed by prune().
+ */
+class ThumbnailCache {
+   public:
+    using Ptr = std::shared_ptr<ThumbnailCache>;
+
+    // Thumbnails older than this get removed, and regenerated if they're still wanted
+    static constexpr std::chrono::seconds s_max_age = std::chrono::hours(24 * 30);
+
+    explicit ThumbnailCache(QString cache_dir, int size = 256);
+
+    int size() const { return m_size; }
+
+    /** Where the thumbnail of 'file' goes. */
+    QString thumbnailPath(const QFileInfo& file) const;
+
+    /** Whether there is an up to date thumbnail of 'file', without decoding it. */
+    bool contains(const QFileInfo& file) const;
+
+    /** Returns the stored thumbnail of 'file', or a null image if there is none or it's out of date. */
+    QImage load(const QFileInfo& file) const;
+
+    /** Stores 'thumbnail' as the thumbnail of 'file', as it is right now. */
+    bool store(const QFileInfo& file, const QImage& thumbnail) const;
+
+    /** Decodes 'file' straight to thumbnail size, centered in a transparent square. Returns a null image on failure. */
+    QImage generate(const QFileInfo& file) const;
+
+    /** Removes the thumbnails whose image doesn't exist anymore, and those older than 'max_age'. Reads every thumbnail's
+     *  text chunks, so better done in the background. */
+    void prune(std::chrono::seconds max_age = s_max_age) const;
+
+   private:
+    QString m_cache_dir;
+    int m_size;
+};
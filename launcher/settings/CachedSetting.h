@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: GPL-3.0-only
+/*
+ *  Prism Launcher - Minecraft Launcher
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, version 3.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <QThread>
+
+#include <memory>
+
+#include "settings/Setting.h"
+
+/*!
+ * \brief A typed handle to a setting, for code that reads it often.
+ * The value is converted once and kept until any setting changes, which also covers override and
+ * passthrough settings that follow other settings. Reads from threads other than the one the
+ * setting lives in skip the cache, as it isn't synchronized.
+ */
+template <typename T>
+class CachedSetting {
+   public:
+    CachedSetting() = default;
+    explicit CachedSetting(std::shared_ptr<Setting> setting) : m_setting(std::move(setting)) {}
+
+    T get() const
+    {
+        if (!m_setting)
+            return T();
+        if (QThread::currentThread() != m_setting->thread())
+            return m_setting->get().template value<T>();
+
+        if (auto generation = Setting::generation(); m_generation != generation) {
+            m_value = m_setting->get().template value<T>();
+            m_generation = generation;
+        }
+        return m_value;
+    }
+
+    T operator*() const { return get(); }
+
+    std::shared_ptr<Setting> setting() const { return m_setting; }
+
+   private:
+    std::shared_ptr<Setting> m_setting;
+    mutable T m_value{};
+    // the generation starts at 1, so the first read always fills the cache
+    mutable quint64 m_generation = 0;
+};
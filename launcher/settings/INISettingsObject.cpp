@@ -16,8 +16,12 @@
 #include "INISettingsObject.h"
 #include "Setting.h"
 
+#include <QCoreApplication>
 #include <QDebug>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
+#include <QThread>
 
 INISettingsObject::INISettingsObject(QStringList paths, QObject* parent) : SettingsObject(parent)
 {
@@ -36,21 +40,37 @@ INISettingsObject::INISettingsObject(QStringList paths, QObject* parent) : Setti
 
     m_filePath = first_path;
     m_ini.loadFile(first_path);
+
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(s_save_delay);
+    connect(&m_saveTimer, &QTimer::timeout, this, &INISettingsObject::flush);
 }
 
 INISettingsObject::INISettingsObject(QString path, QObject* parent) : SettingsObject(parent)
 {
     m_filePath = path;
     m_ini.loadFile(path);
+
+    m_saveTimer.setSingleShot(true);
+    m_saveTimer.setInterval(s_save_delay);
+    connect(&m_saveTimer, &QTimer::timeout, this, &INISettingsObject::flush);
+}
+
+INISettingsObject::~INISettingsObject()
+{
+    flush();
 }
 
 void INISettingsObject::setFilePath(const QString& filePath)
 {
+    // what was changed so far belongs to the old file
+    flush();
     m_filePath = filePath;
 }
 
 bool INISettingsObject::reload()
 {
+    flush();
     return m_ini.loadFile(m_filePath) && SettingsObject::reload();
 }
 
@@ -63,8 +83,27 @@ void INISettingsObject::resumeSave()
 {
     m_suspendSave = false;
     if (m_doSave) {
-        m_ini.saveFile(m_filePath);
+        m_doSave = false;
+        // whoever suspended saving usually does something with the file right after
+        m_dirty = true;
+        flush();
+    }
+}
+
+bool INISettingsObject::flush()
+{
+    if (m_saveTimer.isActive())
+        m_saveTimer.stop();
+    if (!m_dirty)
+        return true;
+    m_dirty = false;
+
+    // Don't bring back the folder of an instance that was deleted or moved while the changes were waiting
+    if (!QFileInfo(m_filePath).dir().exists()) {
+        qWarning() << "Not saving settings to" << m_filePath << "as its folder is gone";
+        return false;
     }
+    return m_ini.saveFile(m_filePath);
 }
 
 void INISettingsObject::changeSetting(const Setting& setting, QVariant value)
@@ -90,9 +129,18 @@ void INISettingsObject::doSave()
 {
     if (m_suspendSave) {
         m_doSave = true;
-    } else {
-        m_ini.saveFile(m_filePath);
+        return;
+    }
+
+    m_dirty = true;
+    // Other threads might not run an event loop to save later on, so they keep saving right away
+    if (auto app = QCoreApplication::instance(); !app || QThread::currentThread() != app->thread() || thread() != app->thread()) {
+        flush();
+        return;
     }
+    // Not restarted by further changes, so a steady stream of them still gets saved every so often
+    if (!m_saveTimer.isActive())
+        m_saveTimer.start();
 }
 
 void INISettingsObject::resetSetting(const Setting& setting)
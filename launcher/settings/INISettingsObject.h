@@ -16,6 +16,9 @@
 #pragma once
 
 #include <QObject>
+#include <QTimer>
+
+#include <chrono>
 
 #include "settings/INIFile.h"
 
@@ -23,6 +26,8 @@
 
 /*!
  * \brief A settings object that stores its settings in an INIFile.
+ * Changes made on the main thread are collected for a moment and written in one go, so that
+ * changing many settings at once doesn't rewrite the file for each of them.
  */
 class INISettingsObject : public SettingsObject {
     Q_OBJECT
@@ -32,6 +37,11 @@ class INISettingsObject : public SettingsObject {
 
     explicit INISettingsObject(QString path, QObject* parent = nullptr);
 
+    ~INISettingsObject() override;
+
+    // How long changes are collected before they get written
+    static constexpr std::chrono::milliseconds s_save_delay = std::chrono::seconds(1);
+
     /*!
      * \brief Gets the path to the INI file.
      * \return The path to the INI file.
@@ -49,6 +59,8 @@ class INISettingsObject : public SettingsObject {
     void suspendSave() override;
     void resumeSave() override;
 
+    bool flush() override;
+
    protected slots:
     virtual void changeSetting(const Setting& setting, QVariant value) override;
     virtual void resetSetting(const Setting& setting) override;
@@ -60,4 +72,8 @@ class INISettingsObject : public SettingsObject {
    protected:
     INIFile m_ini;
     QString m_filePath;
+
+   private:
+    QTimer m_saveTimer;
+    bool m_dirty = false;
 };
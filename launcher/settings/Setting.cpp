@@ -16,6 +16,8 @@
 #include "Setting.h"
 #include "settings/SettingsObject.h"
 
+std::atomic<quint64> Setting::s_generation = 1;
+
 Setting::Setting(QStringList synonyms, QVariant defVal) : QObject(), m_synonyms(synonyms), m_defVal(defVal) {}
 
 QVariant Setting::get() const
@@ -38,10 +40,15 @@ QVariant Setting::defValue() const
 
 void Setting::set(QVariant value)
 {
+    // once so nothing keeps the old value while the change is handled, and once in case it got cached before the change was stored
+    invalidateCachedValues();
     emit SettingChanged(*this, value);
+    invalidateCachedValues();
 }
 
 void Setting::reset()
 {
+    invalidateCachedValues();
     emit settingReset(*this);
+    invalidateCachedValues();
 }
@@ -18,6 +18,7 @@
 #include <QObject>
 #include <QStringList>
 #include <QVariant>
+#include <atomic>
 #include <memory>
 
 class SettingsObject;
@@ -71,6 +72,12 @@ class Setting : public QObject {
      */
     virtual QVariant defValue() const;
 
+    /*!
+     * \brief Gets a number that changes whenever any setting is changed or reset.
+     * Values read before it changed might be out of date. Used by CachedSetting.
+     */
+    static quint64 generation() { return s_generation.load(std::memory_order_relaxed); }
+
    signals:
     /*!
      * \brief Signal emitted when this Setting object's value changes.
@@ -103,7 +110,12 @@ class Setting : public QObject {
 
    protected:
     friend class SettingsObject;
+    static void invalidateCachedValues() { s_generation.fetch_add(1, std::memory_order_relaxed); }
+
     SettingsObject* m_storage;
     QStringList m_synonyms;
     QVariant m_defVal;
+
+   private:
+    static std::atomic<quint64> s_generation;
 };
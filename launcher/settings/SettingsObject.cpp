@@ -110,6 +110,7 @@ bool SettingsObject::contains(const QString& id)
 
 bool SettingsObject::reload()
 {
+    Setting::invalidateCachedValues();
     for (auto setting : m_settings.values()) {
         setting->set(setting->get());
     }
@@ -141,6 +141,14 @@ class SettingsObject : public QObject {
 
     virtual void suspendSave() = 0;
     virtual void resumeSave() = 0;
+
+    /*!
+     * \brief Writes out any changes that are still waiting to be saved.
+     * Changes are saved on their own shortly after they are made, so this is only needed
+     * by code that reads or moves the stored settings right after changing them.
+     * \return True if there was nothing to save or saving was successful
+     */
+    virtual bool flush() = 0;
    signals:
     /*!
      * \brief Signal emitted when one of this SettingsObject object's settings changes.
@@ -59,6 +59,10 @@ auto ConcurrentTask::getStepProgress() const -> TaskStepProgressList
 void ConcurrentTask::addTask(Task::Ptr task)
 {
     m_queue.append(task);
+
+    // Otherwise tasks added while running would only fill the slots that free up afterwards, one at a time
+    if (isRunning())
+        QMetaObject::invokeMethod(this, &ConcurrentTask::executeNextSubTask, Qt::QueuedConnection);
 }
 
 void ConcurrentTask::executeTask()
@@ -149,7 +153,14 @@ void ConcurrentTask::startSubTask(Task::Ptr next)
 
     updateState();
 
-    QMetaObject::invokeMethod(next.get(), &Task::start, Qt::QueuedConnection);
+    // Subtasks can be shared, like the load tasks of metadata entities, in which case one that's already running is waited for
+    QMetaObject::invokeMethod(
+        next.get(),
+        [next] {
+            if (!next->isRunning())
+                next->start();
+        },
+        Qt::QueuedConnection);
 }
 
 void ConcurrentTask::subTaskFinished(Task::Ptr task, TaskStepState state)
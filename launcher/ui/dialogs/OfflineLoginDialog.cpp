@@ -3,6 +3,8 @@
 
 #include <QtWidgets/QPushButton>
 
+#include "ui/widgets/ProgressWidget.h"
+
 OfflineLoginDialog::OfflineLoginDialog(QWidget* parent) : QDialog(parent), ui(new Ui::OfflineLoginDialog)
 {
     ui->setupUi(this);
@@ -89,8 +91,7 @@ void OfflineLoginDialog::onTaskStatus(const QString& status)
 
 void OfflineLoginDialog::onTaskProgress(qint64 current, qint64 total)
 {
-    ui->progressBar->setMaximum(total);
-    ui->progressBar->setValue(current);
+    ProgressWidget::setBarProgress(ui->progressBar, current, total);
 }
 
 // Public interface
@@ -43,6 +43,7 @@
 
 #include "tasks/Task.h"
 
+#include "ui/widgets/ProgressWidget.h"
 #include "ui/widgets/SubTaskProgressBar.h"
 
 // map a value in a numeric range of an arbitrary type to between 0 and INT_MAX
@@ -259,8 +260,7 @@ void ProgressDialog::changeStepProgress(TaskStepProgress const& task_progress)
 
 void ProgressDialog::changeProgress(qint64 current, qint64 total)
 {
-    ui->globalProgressBar->setMaximum(total);
-    ui->globalProgressBar->setValue(current);
+    ProgressWidget::setBarProgress(ui->globalProgressBar, current, total);
 }
 
 void ProgressDialog::keyPressEvent(QKeyEvent* e)
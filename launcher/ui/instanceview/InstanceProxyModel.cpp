@@ -28,13 +28,15 @@ InstanceProxyModel::InstanceProxyModel(QObject* parent) : QSortFilterProxyModel(
     m_naturalSort.setCaseSensitivity(Qt::CaseSensitivity::CaseInsensitive);
     // FIXME: use loaded translation as source of locale instead, hook this up to translation changes
     m_naturalSort.setLocale(QLocale::system());
+    m_sortMode = CachedSetting<QString>(APPLICATION->settings()->getSetting("InstSortMode"));
 }
 
 QVariant InstanceProxyModel::data(const QModelIndex& index, int role) const
 {
     QVariant data = QSortFilterProxyModel::data(index, role);
     if (role == Qt::DecorationRole) {
-        return QVariant(APPLICATION->icons()->getIcon(data.toString()));
+        // asked on every paint, so this must not decode anything here; the instance list repaints once the icon is ready
+        return QVariant(APPLICATION->icons()->getIconAsync(data.toString()));
     }
     return data;
 }
@@ -59,8 +61,7 @@ bool InstanceProxyModel::subSortLessThan(const QModelIndex& left, const QModelIn
 {
     BaseInstance* pdataLeft = static_cast<BaseInstance*>(left.internalPointer());
     BaseInstance* pdataRight = static_cast<BaseInstance*>(right.internalPointer());
-    QString sortMode = APPLICATION->settings()->get("InstSortMode").toString();
-    if (sortMode == "LastLaunch") {
+    if (m_sortMode.get() == "LastLaunch") {
         return pdataLeft->lastLaunch() > pdataRight->lastLaunch();
     } else {
         return m_naturalSort.compare(pdataLeft->name(), pdataRight->name()) < 0;
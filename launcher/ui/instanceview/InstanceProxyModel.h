@@ -18,6 +18,8 @@
 #include <QCollator>
 #include <QSortFilterProxyModel>
 
+#include "settings/CachedSetting.h"
+
 class InstanceProxyModel : public QSortFilterProxyModel {
     Q_OBJECT
 
@@ -31,4 +33,5 @@ class InstanceProxyModel : public QSortFilterProxyModel {
 
    private:
     QCollator m_naturalSort;
+    CachedSetting<QString> m_sortMode;
 };
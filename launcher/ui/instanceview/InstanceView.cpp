@@ -71,6 +71,7 @@ InstanceView::InstanceView(QWidget* parent) : QAbstractItemView(parent)
     setVerticalScrollBarPolicy(Qt::ScrollBarAsNeeded);
     setAcceptDrops(true);
     setAutoScroll(true);
+    m_catOpacity = CachedSetting<int>(APPLICATION->settings()->getSetting("CatOpacity"));
     setPaintCat(APPLICATION->settings()->get("TheCat").toBool());
 }
 
@@ -458,7 +459,7 @@ void InstanceView::paintEvent([[maybe_unused]] QPaintEvent* event)
     QPainter painter(this->viewport());
 
     if (m_catVisible) {
-        painter.setOpacity(APPLICATION->settings()->get("CatOpacity").toFloat() / 100);
+        painter.setOpacity(m_catOpacity.get() / 100.0);
         int widWidth = this->viewport()->width();
         int widHeight = this->viewport()->height();
         if (m_catPixmap.width() < widWidth)
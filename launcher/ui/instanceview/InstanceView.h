@@ -41,6 +41,7 @@
 #include <QScrollBar>
 #include <functional>
 #include "VisualGroup.h"
+#include "settings/CachedSetting.h"
 
 struct InstanceViewRoles {
     enum { GroupRole = Qt::UserRole, ProgressValueRole, ProgressMaximumRole };
@@ -130,6 +131,7 @@ class InstanceView : public QAbstractItemView {
     mutable QCache<int, QRect> geometryCache;
     bool m_catVisible = false;
     QPixmap m_catPixmap;
+    CachedSetting<int> m_catOpacity;
 
     // point where the currently active mouse action started in geometry coordinates
     QPoint m_pressedPosition;
@@ -45,6 +45,7 @@
 #include <QHeaderView>
 #include <QKeyEvent>
 #include <QMenu>
+#include <QScrollBar>
 #include <algorithm>
 
 ExternalResourcesPage::ExternalResourcesPage(BaseInstance* instance, std::shared_ptr<ResourceFolderModel> model, QWidget* parent)
@@ -113,6 +114,16 @@ ExternalResourcesPage::ExternalResourcesPage(BaseInstance* instance, std::shared
     m_model->loadColumns(ui->treeView);
     connect(ui->treeView->header(), &QHeaderView::sectionResized, this, [this] { m_model->saveColumns(ui->treeView); });
     connect(ui->filterEdit, &QLineEdit::textChanged, this, &ExternalResourcesPage::filterTextChanged);
+
+    // Parse whatever is on screen first. Wait for scrolling and batches of new rows to settle before doing so.
+    m_prioritize_timer.setSingleShot(true);
+    m_prioritize_timer.setInterval(50);
+    connect(&m_prioritize_timer, &QTimer::timeout, this, &ExternalResourcesPage::prioritizeVisibleItems);
+    auto schedule_prioritize = [this] { m_prioritize_timer.start(); };
+    connect(ui->treeView->verticalScrollBar(), &QScrollBar::valueChanged, this, schedule_prioritize);
+    connect(m_filterModel, &QSortFilterProxyModel::rowsInserted, this, schedule_prioritize);
+    connect(m_filterModel, &QSortFilterProxyModel::layoutChanged, this, schedule_prioritize);
+    connect(m_filterModel, &QSortFilterProxyModel::modelReset, this, schedule_prioritize);
 }
 
 ExternalResourcesPage::~ExternalResourcesPage()
@@ -144,6 +155,8 @@ void ExternalResourcesPage::ShowHeaderContextMenu(const QPoint& pos)
 void ExternalResourcesPage::openedImpl()
 {
     m_model->startWatching();
+    m_model->resumeParseTasks();
+    m_prioritize_timer.start();
 
     auto const setting_name = QString("WideBarVisibility_%1").arg(id());
     if (!APPLICATION->settings()->contains(setting_name))
@@ -157,10 +170,26 @@ void ExternalResourcesPage::openedImpl()
 void ExternalResourcesPage::closedImpl()
 {
     m_model->stopWatching();
+    m_model->cancelParseTasks();
+    m_prioritize_timer.stop();
 
     m_wide_bar_setting->set(ui->actionsToolbar->getVisibilityState());
 }
 
+void ExternalResourcesPage::prioritizeVisibleItems()
+{
+    auto viewport = ui->treeView->viewport()->rect();
+
+    QModelIndexList visible;
+    for (auto idx = ui->treeView->indexAt(viewport.topLeft()); idx.isValid(); idx = ui->treeView->indexBelow(idx)) {
+        if (ui->treeView->visualRect(idx).top() > viewport.bottom())
+            break;
+        visible.append(m_filterModel->mapToSource(idx));
+    }
+
+    m_model->prioritizeResources(visible);
+}
+
 void ExternalResourcesPage::retranslate()
 {
     ui->retranslateUi(this);
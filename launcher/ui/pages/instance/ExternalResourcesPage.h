@@ -2,6 +2,7 @@
 
 #include <QMainWindow>
 #include <QSortFilterProxyModel>
+#include <QTimer>
 
 #include "Application.h"
 #include "minecraft/MinecraftInstance.h"
@@ -64,6 +65,8 @@ class ExternalResourcesPage : public QMainWindow, public BasePage {
     void ShowContextMenu(const QPoint& pos);
     void ShowHeaderContextMenu(const QPoint& pos);
 
+    void prioritizeVisibleItems();
+
    protected:
     BaseInstance* m_instance = nullptr;
 
@@ -75,4 +78,6 @@ class ExternalResourcesPage : public QMainWindow, public BasePage {
     QString m_viewFilter;
 
     std::shared_ptr<Setting> m_wide_bar_setting = nullptr;
+
+    QTimer m_prioritize_timer;
 };
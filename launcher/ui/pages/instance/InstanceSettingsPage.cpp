@@ -81,11 +81,20 @@ InstanceSettingsPage::InstanceSettingsPage(BaseInstance* inst, QWidget* parent)
     auto mInst = dynamic_cast<MinecraftInstance*>(inst);
     m_world_quickplay_supported = mInst && mInst->traits().contains("feature:is_quick_play_singleplayer");
     if (m_world_quickplay_supported) {
+        // Worlds are read in the background, so fill in the list once they are all there
         auto worlds = mInst->worldList();
+        connect(worlds.get(), &WorldList::updateFinished, this, [this, worlds = worlds.get()] {
+            auto selected = ui->worldsCb->currentText();
+            if (selected.isEmpty())
+                selected = m_settings->get("JoinWorldOnLaunch").toString();
+
+            ui->worldsCb->clear();
+            for (const auto& world : worlds->allWorlds()) {
+                ui->worldsCb->addItem(world.folderName());
+            }
+            ui->worldsCb->setCurrentText(selected);
+        });
         worlds->update();
-        for (const auto& world : worlds->allWorlds()) {
-            ui->worldsCb->addItem(world.folderName());
-        }
     } else {
         ui->worldsCb->hide();
         ui->worldJoinButton->hide();
@@ -43,6 +43,7 @@
 #include <QEvent>
 #include <QFileIconProvider>
 #include <QFileSystemModel>
+#include <QHash>
 #include <QKeyEvent>
 #include <QLineEdit>
 #include <QMap>
@@ -53,6 +54,9 @@
 #include <QRegularExpression>
 #include <QSet>
 #include <QStyledItemDelegate>
+#include <QThreadPool>
+
+#include <mutex>
 
 #include <Application.h>
 
@@ -62,6 +66,7 @@
 #include "net/NetJob.h"
 #include "screenshots/ImgurAlbumCreation.h"
 #include "screenshots/ImgurUpload.h"
+#include "screenshots/ThumbnailCache.h"
 #include "tasks/SequentialTask.h"
 
 #include <DesktopServices.h>
@@ -83,45 +88,41 @@ class ThumbnailingResult : public QObject {
 
 class ThumbnailRunnable : public QRunnable {
    public:
-    ThumbnailRunnable(QString path, SharedIconCachePtr cache)
+    ThumbnailRunnable(QString path, SharedIconCachePtr cache, ThumbnailCache::Ptr diskCache)
     {
         m_path = path;
         m_cache = cache;
+        m_diskCache = diskCache;
     }
     void run()
     {
         QFileInfo info(m_path);
-        if (info.isDir())
-            return;
-        if ((info.suffix().compare("png", Qt::CaseInsensitive) != 0))
-            return;
-        if (!m_cache->stale(m_path))
-            return;
-        QImage image(m_path);
-        if (image.isNull()) {
+        if (info.isDir() || info.suffix().compare("png", Qt::CaseInsensitive) != 0) {
             m_resultEmitter.emitResultsFailed(m_path);
-            qDebug() << "Error loading screenshot: " + m_path + ". Perhaps too large?";
             return;
         }
-        QImage small;
-        if (image.width() > image.height())
-            small = image.scaledToWidth(512).scaledToWidth(256, Qt::SmoothTransformation);
-        else
-            small = image.scaledToHeight(512).scaledToHeight(256, Qt::SmoothTransformation);
-        QPoint offset((256 - small.width()) / 2, (256 - small.height()) / 2);
-        QImage square(QSize(256, 256), QImage::Format_ARGB32);
-        square.fill(Qt::transparent);
-
-        QPainter painter(&square);
-        painter.drawImage(offset, small);
-        painter.end();
-
-        QIcon icon(QPixmap::fromImage(square));
+        if (!m_cache->stale(m_path)) {
+            m_resultEmitter.emitResultsReady(m_path);
+            return;
+        }
+        QImage thumbnail = m_diskCache->load(info);
+        if (thumbnail.isNull()) {
+            thumbnail = m_diskCache->generate(info);
+            if (thumbnail.isNull()) {
+                m_resultEmitter.emitResultsFailed(m_path);
+                qDebug() << "Error loading screenshot: " + m_path + ". Perhaps too large?";
+                return;
+            }
+            m_diskCache->store(info, thumbnail);
+        }
+
+        QIcon icon(QPixmap::fromImage(thumbnail));
         m_cache->add(m_path, icon);
         m_resultEmitter.emitResultsReady(m_path);
     }
     QString m_path;
     SharedIconCachePtr m_cache;
+    ThumbnailCache::Ptr m_diskCache;
     ThumbnailingResult m_resultEmitter;
 };
 
@@ -135,6 +136,10 @@ class FilterModel : public QIdentityProxyModel {
         m_thumbnailingPool.setMaxThreadCount(4);
         m_thumbnailCache = std::make_shared<SharedIconCache>();
         m_thumbnailCache->add("placeholder", APPLICATION->getThemedIcon("screenshot-placeholder"));
+        m_diskCache = std::make_shared<ThumbnailCache>(FS::PathCombine(APPLICATION->dataRoot(), "cache", "thumbnails"));
+        // once per run is plenty
+        static std::once_flag s_pruned;
+        std::call_once(s_pruned, [cache = m_diskCache] { QThreadPool::globalInstance()->start([cache] { cache->prune(); }); });
         connect(&watcher, SIGNAL(fileChanged(QString)), SLOT(fileChanged(QString)));
     }
     virtual ~FilterModel()
@@ -187,16 +192,50 @@ class FilterModel : public QIdentityProxyModel {
     }
 
    private:
-    void thumbnailImage(QString path)
+    void thumbnailImage(QString path, bool changed = false)
     {
-        auto runnable = new ThumbnailRunnable(path, m_thumbnailCache);
+        // A change to a file that is already being thumbnailed may land after it was read, so it gets done again after
+        auto pending = m_pending.find(path);
+        if (pending != m_pending.end()) {
+            *pending = *pending || changed;
+            return;
+        }
+        m_pending.insert(path, false);
+
+        auto runnable = new ThumbnailRunnable(path, m_thumbnailCache, m_diskCache);
         connect(&(runnable->m_resultEmitter), SIGNAL(resultsReady(QString)), SLOT(thumbnailReady(QString)));
         connect(&(runnable->m_resultEmitter), SIGNAL(resultsFailed(QString)), SLOT(thumbnailFailed(QString)));
-        ((QThreadPool&)m_thumbnailingPool).start(runnable);
+        // Only items being painted ask for thumbnails, so the latest requests are the ones on screen right now.
+        // Running those first keeps scrolling through thousands of screenshots from waiting on everything scrolled past.
+        m_thumbnailingPool.start(runnable, m_nextPriority++);
     }
    private slots:
-    void thumbnailReady(QString path) { emit layoutChanged(); }
-    void thumbnailFailed(QString path) { m_failed.insert(path); }
+    void thumbnailReady(QString path)
+    {
+        if (retryChanged(path))
+            return;
+        auto model = qobject_cast<QFileSystemModel*>(sourceModel());
+        if (!model)
+            return;
+        auto index = mapFromSource(model->index(path));
+        if (index.isValid())
+            emit dataChanged(index, index, { Qt::DecorationRole });
+    }
+    void thumbnailFailed(QString path)
+    {
+        if (retryChanged(path))
+            return;
+        m_failed.insert(path);
+    }
+    // Done with the thumbnail of 'path'. Starts over if the file changed in the meantime, and returns whether it did.
+    bool retryChanged(const QString& path)
+    {
+        if (!m_pending.take(path))
+            return false;
+        m_thumbnailCache->setStale(path);
+        thumbnailImage(path);
+        return true;
+    }
     void fileChanged(QString filepath)
     {
         m_thumbnailCache->setStale(filepath);
@@ -204,13 +243,17 @@ class FilterModel : public QIdentityProxyModel {
         watcher.removePath(filepath);
         if (QFile::exists(filepath)) {
             watcher.addPath(filepath);
-            thumbnailImage(filepath);
+            thumbnailImage(filepath, true);
         }
     }
 
    private:
     SharedIconCachePtr m_thumbnailCache;
+    ThumbnailCache::Ptr m_diskCache;
     QThreadPool m_thumbnailingPool;
+    int m_nextPriority = 0;
+    // paths being thumbnailed, and whether they changed since
+    QHash<QString, bool> m_pending;
     QSet<QString> m_failed;
     QSet<QString> watched;
     QFileSystemWatcher watcher;
@@ -21,6 +21,7 @@
 #include "net/NetJob.h"
 
 #include "modplatform/ModIndex.h"
+#include "modplatform/helpers/SearchCache.h"
 
 #include "ui/widgets/ProjectItem.h"
 
@@ -167,6 +168,10 @@ void ResourceModel::search()
     }
     auto args{ createSearchArguments() };
 
+    m_search_scope = searchScope(args);
+    if (args.offset == 0 && args.search.has_value())
+        showLocalMatches(args.search.value());
+
     auto callbacks{ createSearchCallbacks() };
 
     // Use defaults if no callbacks are set
@@ -193,6 +198,49 @@ void ResourceModel::search()
         runSearchJob(job);
 }
 
+QString ResourceModel::searchScope(const ResourceAPI::SearchArgs& args) const
+{
+    // Everything that changes which packs the API could return, besides the search term
+    QStringList scope{ metaEntryBase(), QString::number(static_cast<int>(args.type)) };
+    if (args.loaders.has_value())
+        scope << QString::number(static_cast<int>(args.loaders.value()));
+    if (args.versions.has_value())
+        for (auto& version : args.versions.value())
+            scope << version.toString();
+    scope << args.side.value_or(QString()) << args.categoryIds.value_or(QStringList()).join(',') << QString::number(args.openSource);
+    return scope.join(':');
+}
+
+void ResourceModel::showLocalMatches(const QString& term)
+{
+    auto matches = SearchCache::instance().findPacks(m_search_scope, term, 25);
+
+    QList<ModPlatform::IndexedPack::Ptr> filtered;
+    for (auto& pack : matches) {
+        pack = selectedOr(pack);
+        if (checkFilters(pack))
+            filtered << pack;
+    }
+
+    // When you have a Qt build with assertions turned on, inserting nothing here will abort the application
+    if (filtered.isEmpty())
+        return;
+
+    beginResetModel();
+    m_packs = filtered;
+    m_showing_local_matches = true;
+    endResetModel();
+}
+
+ModPlatform::IndexedPack::Ptr ResourceModel::selectedOr(ModPlatform::IndexedPack::Ptr pack) const
+{
+    auto sel = std::find_if(m_selected.begin(), m_selected.end(), [&pack](const DownloadTaskPtr i) {
+        const auto ipack = i->getPack();
+        return ipack->provider == pack->provider && ipack->addonId == pack->addonId;
+    });
+    return sel != m_selected.end() ? sel->get()->getPack() : pack;
+}
+
 void ResourceModel::loadEntry(QModelIndex& entry)
 {
     auto const& pack = m_packs[entry.row()];
@@ -281,6 +329,7 @@ void ResourceModel::clearData()
 {
     beginResetModel();
     m_packs.clear();
+    m_showing_local_matches = false;
     endResetModel();
 }
 
@@ -394,15 +443,7 @@ void ResourceModel::searchRequestSucceeded(QJsonDocument& doc)
         ModPlatform::IndexedPack::Ptr pack = std::make_shared<ModPlatform::IndexedPack>();
         try {
             loadIndexedPack(*pack, packObj);
-            if (auto sel = std::find_if(m_selected.begin(), m_selected.end(),
-                                        [&pack](const DownloadTaskPtr i) {
-                                            const auto ipack = i->getPack();
-                                            return ipack->provider == pack->provider && ipack->addonId == pack->addonId;
-                                        });
-                sel != m_selected.end()) {
-                newList.append(sel->get()->getPack());
-            } else
-                newList.append(pack);
+            newList.append(selectedOr(pack));
         } catch (const JSONValidationError& e) {
             qWarning() << "Error while loading resource from " << debugName() << ": " << e.cause();
             continue;
@@ -416,6 +457,12 @@ void ResourceModel::searchRequestSucceeded(QJsonDocument& doc)
         m_search_state = SearchState::CanFetchMore;
     }
 
+    SearchCache::instance().insertPacks(m_search_scope, newList);
+
+    // The real results replace whatever the local index came up with
+    if (m_showing_local_matches)
+        clearData();
+
     QList<ModPlatform::IndexedPack::Ptr> filteredNewList;
     for (auto p : newList)
         if (checkFilters(p))
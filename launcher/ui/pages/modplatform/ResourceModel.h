@@ -115,6 +115,13 @@ class ResourceModel : public QAbstractListModel {
 
     [[nodiscard]] auto getCurrentSortingMethodByIndex() const -> std::optional<ResourceAPI::SortingMethod>;
 
+    /** Identifies the set of packs a search with these arguments could find, regardless of the search term. */
+    [[nodiscard]] QString searchScope(const ResourceAPI::SearchArgs& args) const;
+    /** Shows the packs from earlier searches matching 'term', until the results of the actual search come in. */
+    void showLocalMatches(const QString& term);
+    /** Returns the pack already selected for download in place of 'pack', if it's the same project. */
+    [[nodiscard]] ModPlatform::IndexedPack::Ptr selectedOr(ModPlatform::IndexedPack::Ptr pack) const;
+
     /** Converts a JSON document to a common array format.
      *
      *  This is needed so that different providers, with different JSON structures, can be parsed
@@ -154,6 +161,10 @@ class ResourceModel : public QAbstractListModel {
     QList<ModPlatform::IndexedPack::Ptr> m_packs;
     QList<DownloadTaskPtr> m_selected;
 
+    QString m_search_scope;
+    // Whether m_packs holds matches from the local index rather than an actual search result
+    bool m_showing_local_matches = false;
+
     // HACK: We need this to prevent callbacks from calling the model after it has already been deleted.
     // This leaks a tiny bit of memory per time the user has opened a resource dialog. How to make this better?
     static QHash<ResourceModel*, bool> s_running_models;
@@ -6,6 +6,8 @@
 #include <QProgressBar>
 #include <QVBoxLayout>
 
+#include <limits>
+
 #include "tasks/Task.h"
 
 ProgressWidget::ProgressWidget(QWidget* parent, bool show_label) : QWidget(parent)
@@ -106,8 +108,18 @@ void ProgressWidget::handleTaskStatus(const QString& status)
 }
 void ProgressWidget::handleTaskProgress(qint64 current, qint64 total)
 {
-    m_bar->setMaximum(total);
-    m_bar->setValue(current);
+    setBarProgress(m_bar, current, total);
+}
+
+void ProgressWidget::setBarProgress(QProgressBar* bar, qint64 current, qint64 total)
+{
+    // QProgressBar only takes ints, scale byte counts of big copies down to fit
+    while (total > std::numeric_limits<int>::max()) {
+        total /= 1024;
+        current /= 1024;
+    }
+    bar->setMaximum(static_cast<int>(total));
+    bar->setValue(static_cast<int>(current));
 }
 void ProgressWidget::taskDestroyed()
 {
@@ -41,6 +41,9 @@ class ProgressWidget : public QWidget {
     /** Make the widget invisible. */
     void hide();
 
+    /** Show task progress on a progress bar, scaling byte counts that don't fit into an int down. */
+    static void setBarProgress(QProgressBar* bar, qint64 current, qint64 total);
+
    private slots:
     void handleTaskFinish();
     void handleTaskStatus(const QString& status);
@@ -8,6 +8,7 @@
 #include <QVBoxLayout>
 
 #include "VersionProxyModel.h"
+#include "ui/widgets/ProgressWidget.h"
 
 #include "ui/dialogs/CustomMessageBox.h"
 
@@ -157,8 +158,7 @@ void VersionSelectWidget::onTaskFailed(const QString& reason)
 
 void VersionSelectWidget::changeProgress(qint64 current, qint64 total)
 {
-    sneakyProgressBar->setMaximum(total);
-    sneakyProgressBar->setValue(current);
+    ProgressWidget::setBarProgress(sneakyProgressBar, current, total);
 }
 
 void VersionSelectWidget::currentRowChanged(const QModelIndex& current, const QModelIndex&)
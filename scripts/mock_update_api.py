@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Serves the Modrinth and CurseForge endpoints used by update checks, for benchmarking them without the real APIs.
+
+Point the launcher at it by setting these in prismlauncher.cfg:
+
+    ModrinthAPIURLOverride=http://127.0.0.1:8808/modrinth
+    FlameAPIURLOverride=http://127.0.0.1:8808/flame
+
+Every hash and project ID gets an answer with a made-up newer version, so every resource shows up as outdated.
+Requests and the number of IDs in them are logged, which tells how well requests are batched.
+"""
+
+import argparse
+import hashlib
+import json
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+def fake_hash(value, algorithm):
+    return hashlib.new(algorithm if algorithm in ("sha1", "sha512") else "sha1", value.encode()).hexdigest()
+
+
+def modrinth_version(hash, algorithm, loaders, game_versions):
+    return {
+        "id": "v" + hash[:8],
+        "project_id": "p" + hash[:8],
+        "name": "Mock " + hash[:8],
+        "version_number": "2.0.0",
+        "version_type": "release",
+        "changelog": "Newer than whatever you have.",
+        "date_published": "2030-01-01T00:00:00Z",
+        "loaders": loaders or ["fabric"],
+        "game_versions": game_versions or ["1.20.1"],
+        "dependencies": [],
+        "files": [
+            {
+                "primary": True,
+                "filename": "mock-" + hash[:8] + ".jar",
+                "url": "http://127.0.0.1/mock-" + hash[:8] + ".jar",
+                "size": 1024,
+                "hashes": {algorithm: fake_hash(hash, algorithm)},
+            }
+        ],
+    }
+
+
+def flame_file(project_id, game_version):
+    file_id = int(project_id) * 10 + 1
+    return {
+        "id": file_id,
+        "modId": int(project_id),
+        "displayName": "Mock " + str(project_id),
+        "fileName": "mock-" + str(project_id) + ".jar",
+        "releaseType": 1,
+        "fileDate": "2030-01-01T00:00:00Z",
+        "downloadUrl": "http://127.0.0.1/mock-" + str(project_id) + ".jar",
+        "gameVersions": [game_version, "Fabric", "Forge", "NeoForge", "Quilt"],
+        "hashes": [{"value": fake_hash(str(file_id), "sha1"), "algo": 1}],
+        "dependencies": [],
+    }
+
+
+class Handler(BaseHTTPRequestHandler):
+    game_version = "1.20.1"
+    latency = 0.0
+
+    def reply(self, payload):
+        time.sleep(self.latency)
+        body = json.dumps(payload).encode()
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+    def read_json(self):
+        length = int(self.headers.get("Content-Length", 0))
+        return json.loads(self.rfile.read(length) or b"{}")
+
+    def do_POST(self):
+        request = self.read_json()
+
+        if self.path == "/modrinth/version_files/update":
+            hashes = request.get("hashes", [])
+            self.log_message("modrinth update check for %d hashes", len(hashes))
+            algorithm = request.get("algorithm", "sha512")
+            self.reply({h: modrinth_version(h, algorithm, request.get("loaders"), request.get("game_versions")) for h in hashes})
+        elif self.path == "/flame/mods":
+            ids = request.get("modIds", [])
+            self.log_message("flame projects for %d ids", len(ids))
+            self.reply(
+                {
+                    "data": [
+                        {
+                            "id": int(i),
+                            "name": "Mock " + str(i),
+                            "slug": "mock-" + str(i),
+                            "links": {"websiteUrl": "http://127.0.0.1/mock-" + str(i)},
+                            "latestFilesIndexes": [{"gameVersion": self.game_version, "fileId": int(i) * 10 + 1}],
+                        }
+                        for i in ids
+                    ]
+                }
+            )
+        elif self.path == "/flame/mods/files":
+            ids = request.get("fileIds", [])
+            self.log_message("flame files for %d ids", len(ids))
+            self.reply({"data": [flame_file(int(i) // 10, self.game_version) for i in ids]})
+        else:
+            self.send_error(404)
+
+    def do_GET(self):
+        if self.path.startswith("/flame/mods/") and self.path.endswith("/changelog"):
+            self.reply({"data": "Newer than whatever you have."})
+        elif self.path.startswith("/flame/mods/") and "/files" in self.path:
+            project_id = self.path.split("/")[3]
+            self.log_message("flame files for project %s", project_id)
+            self.reply({"data": [flame_file(project_id, self.game_version)]})
+        else:
+            self.send_error(404)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--port", type=int, default=8808)
+    parser.add_argument("--latency", type=float, default=100, help="milliseconds to wait before each response")
+    parser.add_argument("--game-version", default="1.20.1")
+    args = parser.parse_args()
+
+    Handler.latency = args.latency / 1000
+    Handler.game_version = args.game_version
+    ThreadingHTTPServer(("127.0.0.1", args.port), Handler).serve_forever()
+
+
+if __name__ == "__main__":
+    main()
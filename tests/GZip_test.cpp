@@ -1,8 +1,46 @@
+#include <QBuffer>
 #include <QTest>
 
 #include <GZip.h>
 #include <random>
 
+// Log-like text, which compresses about as well as the level.dat and log files the launcher deals with
+QByteArray compressibleData(int size)
+{
+    QByteArray data;
+    data.reserve(size);
+    for (int i = 0; data.size() < size; i++)
+        data.append(QString("[12:34:%1] [Render thread/INFO]: Loaded chunk %2 of world\n").arg(i % 60).arg(i).toUtf8());
+    data.resize(size);
+    return data;
+}
+
+QByteArray streamZip(const QByteArray& data, qint64 chunk)
+{
+    QBuffer target;
+    target.open(QIODevice::WriteOnly);
+    GZipWriter writer(&target);
+    if (!writer.open(QIODevice::WriteOnly))
+        return {};
+    for (qint64 offset = 0; offset < data.size(); offset += chunk)
+        if (writer.write(data.constData() + offset, qMin(chunk, data.size() - offset)) < 0)
+            return {};
+    if (!writer.finish())
+        return {};
+    return target.data();
+}
+
+bool streamUnzip(QByteArray compressed, QByteArray& output)
+{
+    QBuffer source(&compressed);
+    source.open(QIODevice::ReadOnly);
+    GZipReader reader(&source);
+    if (!reader.open(QIODevice::ReadOnly))
+        return false;
+    output = reader.readAll();
+    return reader.atEnd();
+}
+
 void fib(int& prev, int& cur)
 {
     auto ret = prev + cur;
@@ -45,6 +83,156 @@ class GZipTest : public QObject {
             fib(prev, cur);
         } while (cur < size);
     }
+
+    void test_SizeHint()
+    {
+        auto data = compressibleData(100000);
+        QByteArray compressed;
+        QVERIFY(GZip::zip(data, compressed));
+        QCOMPARE(GZip::sizeHint(compressed), qint64(data.size()));
+        QCOMPARE(GZip::sizeHint(QByteArray("short")), qint64(-1));
+    }
+
+    void test_WrongSizeHint()
+    {
+        // With two members the trailer only has the size of the last one, so the size hint is far too small.
+        // unzip() stops at the end of the first member, and has to return all of it anyway.
+        auto data = compressibleData(100000);
+        QByteArray first;
+        QByteArray second;
+        QVERIFY(GZip::zip(data, first));
+        QVERIFY(GZip::zip("tail", second));
+        QCOMPARE(GZip::sizeHint(first + second), qint64(4));
+
+        QByteArray decompressed;
+        QVERIFY(GZip::unzip(first + second, decompressed));
+        QCOMPARE(decompressed, data);
+    }
+
+    void test_LargeSizeHint()
+    {
+        // Compresses well enough for the size hint to be believable, but it's too big to be allocated up front
+        QByteArray data(16 * 1024 * 1024, 'a');
+        QByteArray compressed;
+        QVERIFY(GZip::zip(data, compressed));
+        QCOMPARE(GZip::sizeHint(compressed), qint64(data.size()));
+
+        QByteArray decompressed;
+        QVERIFY(GZip::unzip(compressed, decompressed));
+        QCOMPARE(decompressed, data);
+    }
+
+    void test_StreamingThrough_data()
+    {
+        QTest::addColumn<int>("size");
+        QTest::addColumn<qint64>("chunk");
+
+        QTest::newRow("empty") << 0 << qint64(1);
+        QTest::newRow("tiny") << 1 << qint64(1);
+        QTest::newRow("byte at a time") << 4096 << qint64(1);
+        QTest::newRow("odd chunks") << 300000 << qint64(4099);
+        QTest::newRow("single write") << 5 * 1024 * 1024 << qint64(5 * 1024 * 1024);
+    }
+
+    void test_StreamingThrough()
+    {
+        QFETCH(int, size);
+        QFETCH(qint64, chunk);
+
+        auto data = compressibleData(size);
+        auto compressed = streamZip(data, chunk);
+        QVERIFY(!compressed.isEmpty());
+
+        // Both ways have to understand each other's output
+        QByteArray decompressed;
+        QVERIFY(streamUnzip(compressed, decompressed));
+        QCOMPARE(decompressed, data);
+        if (size > 0) {
+            QVERIFY(GZip::unzip(compressed, decompressed));
+            QCOMPARE(decompressed, data);
+
+            QVERIFY(GZip::zip(data, compressed));
+            QVERIFY(streamUnzip(compressed, decompressed));
+            QCOMPARE(decompressed, data);
+        }
+    }
+
+    void test_StreamingTruncated()
+    {
+        auto data = compressibleData(200000);
+        QByteArray compressed;
+        QVERIFY(GZip::zip(data, compressed));
+        compressed.chop(100);
+
+        QByteArray decompressed;
+        QVERIFY(!streamUnzip(compressed, decompressed));
+        QVERIFY(!GZip::unzip(compressed, decompressed));
+    }
+
+    void test_StreamingGarbage()
+    {
+        QByteArray decompressed;
+        QVERIFY(!streamUnzip(QByteArray(1000, 'x'), decompressed));
+    }
+
+    void bench_Unzip_data()
+    {
+        QTest::addColumn<int>("size");
+        QTest::addColumn<bool>("streaming");
+
+        QTest::newRow("4 KiB, whole buffer") << 4 * 1024 << false;
+        QTest::newRow("4 KiB, streaming") << 4 * 1024 << true;
+        QTest::newRow("8 MiB, whole buffer") << 8 * 1024 * 1024 << false;
+        QTest::newRow("8 MiB, streaming") << 8 * 1024 * 1024 << true;
+    }
+
+    void bench_Unzip()
+    {
+        QFETCH(int, size);
+        QFETCH(bool, streaming);
+
+        auto data = compressibleData(size);
+        QByteArray compressed;
+        QVERIFY(GZip::zip(data, compressed));
+
+        QByteArray decompressed;
+        QBENCHMARK
+        {
+            if (streaming)
+                streamUnzip(compressed, decompressed);
+            else
+                GZip::unzip(compressed, decompressed);
+        }
+        QCOMPARE(decompressed, data);
+    }
+
+    void bench_Zip_data()
+    {
+        QTest::addColumn<int>("size");
+        QTest::addColumn<bool>("streaming");
+
+        QTest::newRow("4 KiB, whole buffer") << 4 * 1024 << false;
+        QTest::newRow("4 KiB, streaming") << 4 * 1024 << true;
+        QTest::newRow("8 MiB, whole buffer") << 8 * 1024 * 1024 << false;
+        QTest::newRow("8 MiB, streaming") << 8 * 1024 * 1024 << true;
+    }
+
+    void bench_Zip()
+    {
+        QFETCH(int, size);
+        QFETCH(bool, streaming);
+
+        auto data = compressibleData(size);
+        QByteArray compressed;
+        QBENCHMARK
+        {
+            if (streaming)
+                compressed = streamZip(data, 64 * 1024);
+            else
+                GZip::zip(data, compressed);
+        }
+        QVERIFY(!compressed.isEmpty());
+    }
 };
 
 QTEST_GUILESS_MAIN(GZipTest)
@@ -1,8 +1,11 @@
 #include <QTest>
 
+#include <settings/CachedSetting.h>
 #include <settings/INIFile.h>
+#include <settings/INISettingsObject.h>
 #include <QList>
 #include <QSettings>
+#include <QTemporaryDir>
 #include <QTemporaryFile>
 #include <QVariant>
 #include "FileSystem.h"
@@ -190,6 +193,56 @@ PreLaunchCommand=)";
         FS::deletePath(fileName);
 #endif
     }
+
+    void test_SettingsObjectCoalescesSaves()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        QString fileName = FS::PathCombine(dir.path(), "instance.cfg");
+
+        auto settings = std::make_shared<INISettingsObject>(fileName);
+        settings->registerSetting("name", "");
+        settings->registerSetting("totalTimePlayed", 0);
+        settings->set("name", "Coalesced");
+        settings->set("totalTimePlayed", 42);
+
+        // nothing is written until the save delay is up
+        QVERIFY(!QFile::exists(fileName));
+        QTRY_VERIFY_WITH_TIMEOUT(QFile::exists(fileName), 5000);
+        INIFile saved;
+        saved.loadFile(fileName);
+        QCOMPARE(saved.get("name", "NOT SET").toString(), "Coalesced");
+        QCOMPARE(saved.get("totalTimePlayed", "NOT SET").toInt(), 42);
+
+        // and flushing doesn't wait for it
+        settings->set("name", "Flushed");
+        QVERIFY(settings->flush());
+        saved.loadFile(fileName);
+        QCOMPARE(saved.get("name", "NOT SET").toString(), "Flushed");
+    }
+
+    void test_CachedSettingFollowsChanges()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+
+        auto global = std::make_shared<INISettingsObject>(FS::PathCombine(dir.path(), "global.cfg"));
+        auto instance = std::make_shared<INISettingsObject>(FS::PathCombine(dir.path(), "instance.cfg"));
+        auto gate = instance->registerSetting("OverrideMemory", false);
+        auto memory = CachedSetting<int>(instance->registerOverride(global->registerSetting("MaxMemAlloc", 4096), gate));
+
+        QCOMPARE(memory.get(), 4096);
+        global->set("MaxMemAlloc", 8192);
+        QCOMPARE(memory.get(), 8192);
+
+        // the gate and the overriding value both count
+        instance->set("MaxMemAlloc", 2048);
+        QCOMPARE(memory.get(), 8192);
+        instance->set("OverrideMemory", true);
+        QCOMPARE(memory.get(), 2048);
+        instance->reset("MaxMemAlloc");
+        QCOMPARE(memory.get(), 8192);
+    }
 };
 
 QTEST_GUILESS_MAIN(IniFileTest)
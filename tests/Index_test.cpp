@@ -1,10 +1,31 @@
+#include <QJsonArray>
+#include <QJsonDocument>
 #include <QTest>
 
+#include <meta/BinaryFormat.h>
 #include <meta/Index.h>
 #include <meta/VersionList.h>
 
 class IndexTest : public QObject {
     Q_OBJECT
+
+    // Shaped like the Forge version list, which is the largest one
+    static QByteArray forgeLikeList()
+    {
+        QJsonArray versions;
+        for (int build = 0; build < 6000; build++) {
+            QJsonObject version{ { "version", QString("14.23.5.%1").arg(build) },
+                                 { "releaseTime", "2019-08-01T12:00:00+00:00" },
+                                 { "type", "release" },
+                                 { "recommended", build == 2860 },
+                                 { "sha256", QString(64, 'a' + build % 6) },
+                                 { "requires", QJsonArray{ QJsonObject{ { "uid", "net.minecraft" }, { "equals", "1.12.2" } } } } };
+            versions.append(version);
+        }
+        QJsonObject list{ { "formatVersion", 1 }, { "uid", "net.minecraftforge" }, { "name", "Forge" }, { "versions", versions } };
+        return QJsonDocument(list).toJson(QJsonDocument::Compact);
+    }
+
    private slots:
     void test_hasUid_and_getList()
     {
@@ -33,6 +54,57 @@ class IndexTest : public QObject {
         windex.merge(std::shared_ptr<Meta::Index>(new Meta::Index({ std::make_shared<Meta::VersionList>("list6") })));
         QCOMPARE(windex.lists().size(), 6);
     }
+
+    void test_versionListSnapshot()
+    {
+        auto json = QJsonDocument::fromJson(forgeLikeList()).object();
+
+        Meta::VersionList parsed("net.minecraftforge");
+        auto snapshot = parsed.parseWithSnapshot(json);
+        QVERIFY(!snapshot.isEmpty());
+
+        Meta::VersionList loaded("net.minecraftforge");
+        QVERIFY(loaded.loadSnapshot(snapshot));
+        QCOMPARE(loaded.name(), parsed.name());
+        QCOMPARE(loaded.count(), parsed.count());
+        for (int i = 0; i < parsed.count(); i++) {
+            auto a = parsed.versions().at(i);
+            auto b = loaded.versions().at(i);
+            QCOMPARE(b->version(), a->version());
+            QCOMPARE(b->rawTime(), a->rawTime());
+            QCOMPARE(b->type(), a->type());
+            QCOMPARE(b->isRecommended(), a->isRecommended());
+            QCOMPARE(b->sha256(), a->sha256());
+            QVERIFY(b->requiredSet() == a->requiredSet());
+            QCOMPARE(b->requiredSet().begin()->equalsVersion, a->requiredSet().begin()->equalsVersion);
+        }
+        QCOMPARE(loaded.getRecommended()->descriptor(), parsed.getRecommended()->descriptor());
+
+        // broken snapshots get parsed from JSON again
+        QVERIFY(!Meta::VersionList("net.minecraftforge").loadSnapshot(snapshot.left(snapshot.size() / 2)));
+        QVERIFY(!Meta::VersionList("net.minecraftforge").loadSnapshot(Meta::writeIndexSnapshot(Meta::Index())));
+    }
+
+    void test_loadListFromJson_benchmark()
+    {
+        auto data = forgeLikeList();
+        QBENCHMARK
+        {
+            Meta::VersionList list("net.minecraftforge");
+            list.parse(QJsonDocument::fromJson(data).object());
+        }
+    }
+
+    void test_loadListFromSnapshot_benchmark()
+    {
+        Meta::VersionList parsed("net.minecraftforge");
+        auto snapshot = parsed.parseWithSnapshot(QJsonDocument::fromJson(forgeLikeList()).object());
+        QBENCHMARK
+        {
+            Meta::VersionList list("net.minecraftforge");
+            QVERIFY(list.loadSnapshot(snapshot));
+        }
+    }
 };
 
 QTEST_GUILESS_MAIN(IndexTest)
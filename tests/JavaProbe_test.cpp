@@ -0,0 +1,104 @@
+#include <QCoreApplication>
+#include <QSysInfo>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <FileSystem.h>
+#include <java/JavaProbe.h>
+
+class JavaProbeTest : public QObject {
+    Q_OBJECT
+
+    // Stand in for a Java install, using our own executable as the binary, since it is in the format of the running system
+    QString makeFakeJava(const QTemporaryDir& home, const QByteArray& release)
+    {
+        auto bin = FS::PathCombine(home.path(), "bin");
+        FS::ensureFolderPathExists(bin);
+#ifdef Q_OS_WIN
+        auto java = FS::PathCombine(bin, "java.exe");
+#else
+        auto java = FS::PathCombine(bin, "java");
+#endif
+        if (!QFile::copy(QCoreApplication::applicationFilePath(), java))
+            return {};
+        FS::write(FS::PathCombine(home.path(), "release"), release);
+        return java;
+    }
+
+   private slots:
+    void test_normalizeArch()
+    {
+        QCOMPARE(JavaProbe::normalizeArch("amd64"), JavaProbe::normalizeArch("x86_64"));
+        QCOMPARE(JavaProbe::normalizeArch("i686"), JavaProbe::normalizeArch("x86"));
+        QCOMPARE(JavaProbe::normalizeArch("aarch64"), JavaProbe::normalizeArch("arm64"));
+        QVERIFY(JavaProbe::normalizeArch("aarch64") != JavaProbe::normalizeArch("amd64"));
+    }
+
+    void test_is64BitArch_data()
+    {
+        QTest::addColumn<QString>("arch");
+        QTest::addColumn<bool>("is_64bit");
+        QTest::newRow("amd64") << "amd64" << true;
+        QTest::newRow("aarch64") << "aarch64" << true;
+        QTest::newRow("ppc64") << "ppc64" << true;
+        QTest::newRow("ppc64le") << "ppc64le" << true;
+        QTest::newRow("riscv64") << "riscv64" << true;
+        QTest::newRow("s390x") << "s390x" << true;
+        QTest::newRow("i686") << "i686" << false;
+        QTest::newRow("arm") << "arm" << false;
+        QTest::newRow("ppc") << "ppc" << false;
+    }
+    void test_is64BitArch()
+    {
+        QFETCH(QString, arch);
+        QFETCH(bool, is_64bit);
+        QCOMPARE(JavaProbe::is64BitArch(arch), is_64bit);
+    }
+
+    void test_binaryArchitecture()
+    {
+        auto arch = JavaProbe::binaryArchitecture(QCoreApplication::applicationFilePath());
+        if (arch.isEmpty())
+            QSKIP("Executable format of this system isn't supported");
+        QCOMPARE(JavaProbe::normalizeArch(arch), JavaProbe::normalizeArch(QSysInfo::buildCpuArchitecture()));
+    }
+
+    void test_probeWithoutJvm()
+    {
+        QTemporaryDir home;
+        QVERIFY(home.isValid());
+
+        auto arch = QSysInfo::buildCpuArchitecture();
+        auto java = makeFakeJava(home, "IMPLEMENTOR=\"Eclipse Adoptium\"\nJAVA_VERSION=\"17.0.9\"\nOS_ARCH=\"" + arch.toUtf8() + "\"\n");
+        QVERIFY(!java.isEmpty());
+        if (JavaProbe::binaryArchitecture(java).isEmpty())
+            QSKIP("Executable format of this system isn't supported");
+
+        auto result = JavaProbe::probeWithoutJvm(java);
+        QVERIFY(result.has_value());
+        QVERIFY(result->validity == JavaChecker::Result::Validity::Valid);
+        QCOMPARE(result->javaVersion.toString(), QString("17.0.9"));
+        QCOMPARE(result->javaVendor, QString("Eclipse Adoptium"));
+        QCOMPARE(result->path, java);
+    }
+
+    void test_probeWithoutJvm_uncertain()
+    {
+        QTemporaryDir home;
+        QVERIFY(home.isValid());
+
+        // A release file that doesn't match the binary shouldn't be trusted
+        auto other_arch = JavaProbe::normalizeArch(QSysInfo::buildCpuArchitecture()) == "x86_64" ? "aarch64" : "amd64";
+        auto java = makeFakeJava(home, QByteArray("IMPLEMENTOR=\"Test\"\nJAVA_VERSION=\"21\"\nOS_ARCH=\"") + other_arch + "\"\n");
+        QVERIFY(!java.isEmpty());
+        QVERIFY(!JavaProbe::probeWithoutJvm(java).has_value());
+
+        // Neither should an incomplete one
+        FS::write(FS::PathCombine(home.path(), "release"), "JAVA_VERSION=\"21\"\n");
+        QVERIFY(!JavaProbe::probeWithoutJvm(java).has_value());
+    }
+};
+
+QTEST_GUILESS_MAIN(JavaProbeTest)
+
+#include "JavaProbe_test.moc"
@@ -0,0 +1,276 @@
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <FileSystem.h>
+#include <JsonReader.h>
+#include <meta/JsonFormat.h>
+#include <meta/Version.h>
+#include <meta/VersionList.h>
+#include <minecraft/AssetsUtils.h>
+
+class JsonReaderTest : public QObject {
+    Q_OBJECT
+
+    // Shaped like the asset index of a recent Minecraft version
+    static QByteArray assetIndex()
+    {
+        QJsonObject objects;
+        for (int i = 0; i < 4000; i++)
+            objects.insert(QString("minecraft/sounds/block/thing%1/step%2.ogg").arg(i / 10).arg(i % 10),
+                           QJsonObject{ { "hash", QString("%1").arg(i, 40, 16, QChar('0')) }, { "size", 10000 + i } });
+        return QJsonDocument(QJsonObject{ { "objects", objects } }).toJson(QJsonDocument::Compact);
+    }
+
+    // Shaped like the meta version list of Forge
+    static QByteArray versionList()
+    {
+        QJsonArray versions;
+        for (int i = 0; i < 3000; i++) {
+            versions.append(QJsonObject{
+                { "version", QString("%1.%2.%3").arg(40 + i / 100).arg(i / 10 % 10).arg(i % 10) },
+                { "releaseTime", "2023-06-01T12:00:00+00:00" },
+                { "type", i % 3 ? "release" : "snapshot" },
+                { "recommended", i % 50 == 0 },
+                { "sha256", QString("%1").arg(i, 64, 16, QChar('0')) },
+                { "requires", QJsonArray{ QJsonObject{ { "uid", "net.minecraft" }, { "equals", QString("1.%1").arg(i / 200) } } } } });
+        }
+        QJsonObject list{ { "formatVersion", 1 }, { "name", "Forge" }, { "uid", "net.minecraftforge" }, { "versions", versions } };
+        return QJsonDocument(list).toJson(QJsonDocument::Compact);
+    }
+
+    // Shaped like a page of Modrinth search results
+    static QByteArray searchResponse()
+    {
+        QJsonArray hits;
+        for (int i = 0; i < 100; i++) {
+            hits.append(QJsonObject{ { "project_id", QString("P%1").arg(i) },
+                                     { "slug", QString("mod-%1").arg(i) },
+                                     { "title", QString("Mod \"%1\"").arg(i) },
+                                     { "description", QString(200, 'd') },
+                                     { "categories", QJsonArray{ "fabric", "forge", "technology" } },
+                                     { "downloads", 123456 + i },
+                                     { "follows", 42 },
+                                     { "icon_url", QString("https://cdn.modrinth.com/data/P%1/icon.png").arg(i) },
+                                     { "versions", QJsonArray{ "1.19.2", "1.19.3", "1.19.4", "1.20", "1.20.1" } },
+                                     { "date_modified", "2023-06-01T12:00:00.000000Z" } });
+        }
+        QJsonObject page{ { "hits", hits }, { "offset", 0 }, { "limit", 100 }, { "total_hits", 9000 } };
+        return QJsonDocument(page).toJson(QJsonDocument::Indented);
+    }
+
+    // Touches every value once, so that both ways of reading do the same work
+    static int walk(const QJsonValue& value)
+    {
+        int count = 1;
+        if (value.isObject()) {
+            auto object = value.toObject();
+            for (auto it = object.begin(); it != object.end(); ++it)
+                count += walk(it.value());
+        } else if (value.isArray()) {
+            for (auto element : value.toArray())
+                count += walk(element);
+        } else if (value.isString()) {
+            count += value.toString().isEmpty() ? 0 : 1;
+        }
+        return count;
+    }
+
+    static int walk(Json::Reader& reader)
+    {
+        int count = 1;
+        switch (reader.peek()) {
+            case Json::Reader::Type::Object: {
+                reader.beginObject();
+                std::string_view key;
+                while (reader.nextKey(key))
+                    count += walk(reader);
+                break;
+            }
+            case Json::Reader::Type::Array:
+                reader.beginArray();
+                while (reader.nextElement())
+                    count += walk(reader);
+                break;
+            case Json::Reader::Type::String:
+                count += reader.readString().isEmpty() ? 0 : 1;
+                break;
+            default:
+                reader.skip();
+        }
+        return count;
+    }
+
+   private slots:
+    void test_readValues()
+    {
+        QByteArray data = R"({ "name": "A\"b\u00e9\ud83d\ude00", "count": -42, "ratio": 2.5e1, "ok": true, "none": null,
+                               "list": [1, [], {}], "skipped": {"a": [1, {"b": "c"}]} })";
+        Json::Reader reader(data);
+        reader.beginObject();
+        std::string_view key;
+
+        QVERIFY(reader.nextKey(key));
+        QVERIFY(key == "name");
+        QCOMPARE(reader.readString(), QString::fromUtf8("A\"b\xc3\xa9\xf0\x9f\x98\x80"));
+        QVERIFY(reader.nextKey(key));
+        QCOMPARE(reader.readInteger(), qint64(-42));
+        QVERIFY(reader.nextKey(key));
+        QCOMPARE(reader.readDouble(), 25.0);
+        QVERIFY(reader.nextKey(key));
+        QVERIFY(reader.peek() == Json::Reader::Type::Bool);
+        QVERIFY(reader.readBool());
+        QVERIFY(reader.nextKey(key));
+        QVERIFY(reader.readNull());
+        QVERIFY(reader.nextKey(key));
+        QCOMPARE(reader.readValue(), QJsonValue(QJsonArray{ 1, QJsonArray(), QJsonObject() }));
+        QVERIFY(reader.nextKey(key));
+        QVERIFY(key == "skipped");
+        reader.skip();
+        QVERIFY(!reader.nextKey(key));
+        reader.end();
+    }
+
+    void test_sameAsDocument()
+    {
+        for (auto& data : { assetIndex(), searchResponse() }) {
+            Json::Reader reader(data);
+            QCOMPARE(reader.readValue(), QJsonValue(QJsonDocument::fromJson(data).object()));
+            reader.end();
+        }
+    }
+
+    void test_rejectsInvalid_data()
+    {
+        QTest::addColumn<QByteArray>("data");
+        QTest::newRow("trailing comma") << QByteArray("[1,]");
+        QTest::newRow("missing comma") << QByteArray("[1 2]");
+        QTest::newRow("missing colon") << QByteArray("{\"a\" 1}");
+        QTest::newRow("unterminated string") << QByteArray("[\"abc");
+        QTest::newRow("bad escape") << QByteArray("[\"\\q\"]");
+        QTest::newRow("leading zero") << QByteArray("01");
+        QTest::newRow("bare fraction") << QByteArray("1.");
+        QTest::newRow("unclosed array") << QByteArray("[[]");
+        QTest::newRow("garbage") << QByteArray("{} x");
+        QTest::newRow("too deep") << QByteArray(2000, '[');
+    }
+    void test_rejectsInvalid()
+    {
+        QFETCH(QByteArray, data);
+        Json::Reader reader(data);
+        bool thrown = false;
+        try {
+            reader.skip();
+            reader.end();
+        } catch (const Json::JsonException&) {
+            thrown = true;
+        }
+        QVERIFY(thrown);
+    }
+
+    void test_assetsIndex()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        auto path = FS::PathCombine(dir.path(), "index.json");
+        FS::write(path, R"({"virtual": true, "objects": {"icons/icon_16x16.png": {"hash": "bdf48ef6b5d0d23bbb02e17d04865216179f510a",
+                           "size": 3665}, "pack.mcmeta": {"size": 123, "hash": "abc"}}})");
+
+        AssetsIndex index;
+        QVERIFY(AssetsUtils::loadAssetsIndexJson("test", path, index));
+        QVERIFY(index.isVirtual);
+        QVERIFY(!index.mapToResources);
+        QCOMPARE(index.objects.size(), 2);
+        QCOMPARE(index.objects["icons/icon_16x16.png"].hash, QString("bdf48ef6b5d0d23bbb02e17d04865216179f510a"));
+        QCOMPARE(index.objects["icons/icon_16x16.png"].size, qint64(3665));
+        QCOMPARE(index.objects["pack.mcmeta"].size, qint64(123));
+
+        FS::write(path, R"({"objects": {"a": {"hash": "b"})");
+        QVERIFY(!AssetsUtils::loadAssetsIndexJson("test", path, index));
+    }
+
+    void test_versionList()
+    {
+        auto data = versionList();
+        auto fromDocument = Meta::parseVersionList(QJsonDocument::fromJson(data).object());
+        auto fromReader = Meta::parseVersionList(data, "list");
+
+        QCOMPARE(fromReader->uid(), fromDocument->uid());
+        QCOMPARE(fromReader->name(), fromDocument->name());
+        QCOMPARE(fromReader->count(), fromDocument->count());
+        for (int i = 0; i < fromDocument->count(); i++) {
+            auto expected = fromDocument->versions().at(i);
+            auto actual = fromReader->versions().at(i);
+            QCOMPARE(actual->uid(), expected->uid());
+            QCOMPARE(actual->version(), expected->version());
+            QCOMPARE(actual->type(), expected->type());
+            QCOMPARE(actual->rawTime(), expected->rawTime());
+            QCOMPARE(actual->isRecommended(), expected->isRecommended());
+            QCOMPARE(actual->requiredSet().size(), expected->requiredSet().size());
+            QVERIFY(actual->requiredSet().begin()->deepEquals(*expected->requiredSet().begin()));
+        }
+
+        // The uid can come after the versions, and a list in an unknown format is still refused
+        auto uidLast = Meta::parseVersionList(R"({"versions": [{"version": "1", "releaseTime": "2023-06-01T12:00:00+00:00"}],
+                                                 "formatVersion": 1, "uid": "a"})",
+                                              "list");
+        QCOMPARE(uidLast->versions().at(0)->uid(), QString("a"));
+        bool thrown = false;
+        try {
+            Meta::parseVersionList(R"({"formatVersion": 2, "uid": "a", "versions": []})", "list");
+        } catch (const Exception&) {
+            thrown = true;
+        }
+        QVERIFY(thrown);
+    }
+
+    void test_documentBenchmark_data()
+    {
+        QTest::addColumn<QByteArray>("data");
+        QTest::newRow("asset index") << assetIndex();
+        QTest::newRow("search response") << searchResponse();
+    }
+    void test_documentBenchmark()
+    {
+        QFETCH(QByteArray, data);
+        QBENCHMARK
+        {
+            QVERIFY(walk(QJsonDocument::fromJson(data).object()) > 0);
+        }
+    }
+
+    void test_readerBenchmark_data() { test_documentBenchmark_data(); }
+    void test_readerBenchmark()
+    {
+        QFETCH(QByteArray, data);
+        QBENCHMARK
+        {
+            Json::Reader reader(data);
+            QVERIFY(walk(reader) > 0);
+        }
+    }
+
+    // What the meta loader does with a downloaded version list, both ways
+    void test_versionListDocumentBenchmark()
+    {
+        auto data = versionList();
+        QBENCHMARK
+        {
+            QVERIFY(Meta::parseVersionList(QJsonDocument::fromJson(data).object())->count() > 0);
+        }
+    }
+    void test_versionListReaderBenchmark()
+    {
+        auto data = versionList();
+        QBENCHMARK
+        {
+            QVERIFY(Meta::parseVersionList(data, "list")->count() > 0);
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(JsonReaderTest)
+
+#include "JsonReader_test.moc"
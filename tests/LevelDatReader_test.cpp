@@ -0,0 +1,86 @@
+#include <QBuffer>
+#include <QTest>
+
+#include <io/stream_writer.h>
+#include <nbt_tags.h>
+#include <sstream>
+
+#include <GZip.h>
+#include <minecraft/LevelDatReader.h>
+
+class LevelDatReaderTest : public QObject {
+    Q_OBJECT
+
+    // Mimics a modded level.dat, with a lot of data the launcher doesn't care about before the bits it reads
+    static QByteArray makeLevelDat(bool modern, int registry_entries)
+    {
+        nbt::tag_compound registries;
+        for (int i = 0; i < registry_entries; i++) {
+            nbt::tag_list entries;
+            entries.push_back(nbt::tag_compound{ { "id", int32_t(i) }, { "name", "modid:some_registry_entry" } });
+            entries.push_back(nbt::tag_compound{ { "id", int32_t(i + 1) }, { "name", "modid:another_registry_entry" } });
+            registries.put("modid:registry_" + std::to_string(i), std::move(entries));
+        }
+
+        nbt::tag_compound data;
+        data.put("Registries", std::move(registries));
+        data.put("DataPacks", nbt::tag_int_array{ 1, 2, 3 });
+        data.put("LevelName", "Streamed World");
+        data.put("LastPlayed", int64_t(1700000000000));
+        data.put("GameType", int32_t(1));
+        if (modern)
+            data.put("WorldGenSettings", nbt::tag_compound{ { "dimensions", nbt::tag_compound{} }, { "seed", int64_t(-42) } });
+        else
+            data.put("RandomSeed", int64_t(1234));
+
+        nbt::tag_compound root;
+        root.put("Data", std::move(data));
+
+        std::ostringstream stream;
+        nbt::io::write_tag("", root, stream);
+        auto raw = stream.str();
+
+        QByteArray compressed;
+        GZip::zip(QByteArray(raw.data(), static_cast<int>(raw.size())), compressed);
+        return compressed;
+    }
+
+    static std::optional<LevelDatInfo> read(QByteArray data)
+    {
+        QBuffer buffer(&data);
+        buffer.open(QIODevice::ReadOnly);
+        return LevelDatReader::read(buffer);
+    }
+
+   private slots:
+    void test_modern()
+    {
+        auto info = read(makeLevelDat(true, 2000));
+        QVERIFY(info.has_value());
+        QCOMPARE(info->levelName.value_or(QString()), QString("Streamed World"));
+        QCOMPARE(info->lastPlayed.value_or(0), int64_t(1700000000000));
+        QCOMPARE(info->gameType.value_or(-1), 1);
+        QCOMPARE(info->worldGenSeed.value_or(0), int64_t(-42));
+        QVERIFY(!info->randomSeed.has_value());
+    }
+
+    void test_legacy()
+    {
+        auto info = read(makeLevelDat(false, 0));
+        QVERIFY(info.has_value());
+        QCOMPARE(info->levelName.value_or(QString()), QString("Streamed World"));
+        QCOMPARE(info->randomSeed.value_or(0), int64_t(1234));
+        QVERIFY(!info->worldGenSeed.has_value());
+    }
+
+    void test_truncated()
+    {
+        auto data = makeLevelDat(true, 100);
+        QVERIFY(!read(data.left(data.size() / 2)).has_value());
+        QVERIFY(!read(QByteArray("not a level.dat")).has_value());
+    }
+};
+
+QTEST_GUILESS_MAIN(LevelDatReaderTest)
+
+#include "LevelDatReader_test.moc"
@@ -0,0 +1,65 @@
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <FileSystem.h>
+#include <minecraft/update/LibrariesManifest.h>
+
+class LibrariesManifestTest : public QObject {
+    Q_OBJECT
+
+   private slots:
+    void test_verify()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        auto manifest = FS::PathCombine(dir.path(), "libraries-verified.json");
+        QStringList files{ FS::PathCombine(dir.path(), "a.jar"), FS::PathCombine(dir.path(), "b.jar") };
+        QByteArray metadata("metadata");
+        FS::write(files[0], "a");
+        FS::write(files[1], "b");
+
+        QVERIFY(!LibrariesManifest::verify(manifest, files, metadata));
+        QVERIFY(LibrariesManifest::write(manifest, files, metadata));
+        QVERIFY(LibrariesManifest::verify(manifest, files, metadata));
+
+        // A different set of files needs the usual check
+        QVERIFY(!LibrariesManifest::verify(manifest, files.mid(0, 1), metadata));
+        QVERIFY(!LibrariesManifest::verify(manifest, { files[1], files[0] }, metadata));
+
+        // So do the same files coming from somewhere else
+        QVERIFY(!LibrariesManifest::verify(manifest, files, "other metadata"));
+
+        // And a file that changed
+        FS::write(files[1], "bigger");
+        QVERIFY(!LibrariesManifest::verify(manifest, files, metadata));
+
+        FS::write(manifest, "garbage");
+        QVERIFY(!LibrariesManifest::verify(manifest, files, metadata));
+    }
+
+    void test_missingFiles()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        auto manifest = FS::PathCombine(dir.path(), "libraries-verified.json");
+        QStringList files{ FS::PathCombine(dir.path(), "a.jar"), FS::PathCombine(dir.path(), "never-downloaded.jar") };
+        QByteArray metadata("metadata");
+        FS::write(files[0], "a");
+
+        // Files that aren't there are never fine, so they can't be recorded
+        QVERIFY(!LibrariesManifest::write(manifest, files, metadata));
+        QVERIFY(!QFile::exists(manifest));
+        QVERIFY(!LibrariesManifest::verify(manifest, files, metadata));
+
+        // And files that went away since get noticed
+        FS::write(files[1], "b");
+        QVERIFY(LibrariesManifest::write(manifest, files, metadata));
+        QVERIFY(QFile::remove(files[1]));
+        QVERIFY(!LibrariesManifest::verify(manifest, files, metadata));
+    }
+};
+
+QTEST_GUILESS_MAIN(LibrariesManifestTest)
+
+#include "LibrariesManifest_test.moc"
@@ -322,6 +322,42 @@ class LibraryTest : public QObject {
         QCOMPARE(dls[1]->url(),
                  QUrl("https://libraries.minecraft.net/tv/twitch/twitch-platform/5.16/twitch-platform-5.16-natives-windows-64.jar"));
     }
+    void test_rules_data()
+    {
+        QTest::addColumn<QByteArray>("rules");
+        QTest::addColumn<QString>("system");
+        QTest::addColumn<QString>("realArch");
+        QTest::addColumn<bool>("active");
+
+        QByteArray notOnMac = R"([{"action": "allow"}, {"action": "disallow", "os": {"name": "osx"}}])";
+        QTest::newRow("allowed but not here, elsewhere") << notOnMac << "linux" << "amd64" << true;
+        QTest::newRow("allowed but not here, here") << notOnMac << "osx" << "amd64" << false;
+        QTest::newRow("allowed but not here, imprecise on arm") << notOnMac << "osx" << "aarch64" << true;
+
+        QByteArray onlyOnMac = R"([{"action": "allow", "os": {"name": "osx"}}])";
+        QTest::newRow("only here, here") << onlyOnMac << "osx" << "x86_64" << true;
+        QTest::newRow("only here, elsewhere") << onlyOnMac << "windows" << "x86_64" << false;
+
+        QByteArray onlyOnArmMac = R"([{"action": "allow", "os": {"name": "osx-arm64"}}])";
+        QTest::newRow("precise, here") << onlyOnArmMac << "osx" << "aarch64" << true;
+        QTest::newRow("precise, other arch") << onlyOnArmMac << "osx" << "amd64" << false;
+
+        QByteArray ignored = R"([{"action": "maybe"}])";
+        QTest::newRow("no usable rules") << ignored << "linux" << "amd64" << true;
+    }
+    void test_rules()
+    {
+        QFETCH(QByteArray, rules);
+        QFETCH(QString, system);
+        QFETCH(QString, realArch);
+        QFETCH(bool, active);
+
+        Library library("com.example:thing:1.0");
+        library.setRules(rulesFromJsonV4(QJsonObject{ { "rules", QJsonDocument::fromJson(rules).array() } }));
+        // a different context right before must not leak into the next check
+        library.isActive(dummyContext("windows", "32", "x86"));
+        QCOMPARE(library.isActive(dummyContext(system, "64", realArch)), active);
+    }
 
    private:
     std::unique_ptr<HttpMetaCache> cache;
@@ -82,6 +82,40 @@ class PackwizTest : public QObject {
         QCOMPARE(metadata.file_id, 3509043);
         QCOMPARE(metadata.project_id, 327154);
     }
+
+    void loadAll_Cached()
+    {
+        QString source = QFINDTESTDATA("testdata/Packwiz");
+
+        QTemporaryDir tmp;
+        QVERIFY(tmp.isValid());
+        QDir index_dir(tmp.path());
+        for (auto& file_name : QDir(source).entryList({ "*.pw.toml" }, QDir::Files))
+            QVERIFY(QFile::copy(QDir(source).absoluteFilePath(file_name), index_dir.absoluteFilePath(file_name)));
+
+        auto mods = Packwiz::V1::getAllIndexes(index_dir);
+        QCOMPARE(mods.size(), 2);
+        QVERIFY(index_dir.exists("index.cache"));
+
+        // Second run comes from the cache, and should give back the same data
+        auto cached = Packwiz::V1::getAllIndexes(index_dir);
+        QCOMPARE(cached.size(), 2);
+        for (auto& mod : mods) {
+            auto it = std::find_if(cached.begin(), cached.end(), [&mod](auto& other) { return other.slug == mod.slug; });
+            QVERIFY(it != cached.end());
+            QCOMPARE(it->name, mod.name);
+            QCOMPARE(it->filename, mod.filename);
+            QCOMPARE(it->url, mod.url);
+            QCOMPARE(it->hash, mod.hash);
+            QCOMPARE(it->provider, mod.provider);
+            QCOMPARE(it->project_id, mod.project_id);
+            QCOMPARE(it->file_id, mod.file_id);
+        }
+
+        // Removed files should not come back from the cache
+        QVERIFY(index_dir.remove("borderless-mining.pw.toml"));
+        QCOMPARE(Packwiz::V1::getAllIndexes(index_dir).size(), 1);
+    }
 };
 
 QTEST_GUILESS_MAIN(PackwizTest)
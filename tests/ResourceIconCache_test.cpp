@@ -0,0 +1,78 @@
+#include <QBuffer>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <FileSystem.h>
+#include <minecraft/mod/ResourceIconCache.h>
+
+class ResourceIconCacheTest : public QObject {
+    Q_OBJECT
+
+    static QFileInfo makeResource(const QString& dir, const QString& name)
+    {
+        auto path = FS::PathCombine(dir, name);
+        FS::write(path, name.toUtf8());
+        return QFileInfo(path);
+    }
+
+    static QImage makeImage(QSize size, QColor color)
+    {
+        QImage image(size, QImage::Format_ARGB32);
+        image.fill(color);
+        return image;
+    }
+
+   private slots:
+    void test_Decode()
+    {
+        QByteArray png;
+        QBuffer buffer(&png);
+        buffer.open(QIODevice::WriteOnly);
+        makeImage({ 512, 256 }, Qt::red).save(&buffer, "png");
+
+        // Scaled down while decoding, covering the icon size on both sides
+        auto icon = ResourceIconCache::decode(png);
+        QCOMPARE(icon.size(), QSize(128, 64));
+
+        QVERIFY(ResourceIconCache::decode("not an image").isNull());
+    }
+
+    void test_Insert()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ResourceIconCache cache({}, 1024);
+
+        auto resource = makeResource(dir.path(), "pack.zip");
+        QVERIFY(cache.find(resource).isNull());
+
+        auto stored = cache.insert(resource, makeImage({ 256, 256 }, Qt::blue));
+        QCOMPARE(stored.size(), QSize(64, 64));
+        QCOMPARE(cache.find(resource).pixelColor(0, 0), QColor(Qt::blue));
+    }
+
+    void test_DiskFallback()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        // A single icon is 16 KiB, so every insert pushes the previous one out of memory
+        ResourceIconCache cache(FS::PathCombine(dir.path(), "icons"), 16);
+
+        auto first = makeResource(dir.path(), "first.jar");
+        auto second = makeResource(dir.path(), "second.jar");
+        cache.insert(first, makeImage({ 64, 64 }, Qt::red));
+        cache.insert(second, makeImage({ 64, 64 }, Qt::green));
+
+        QCOMPARE(cache.find(first).pixelColor(0, 0), QColor(Qt::red));
+        QCOMPARE(cache.find(second).pixelColor(0, 0), QColor(Qt::green));
+
+        // Once the file changes, neither memory nor disk has an icon for it
+        FS::write(first.filePath(), "a different jar");
+        first.refresh();
+        QVERIFY(cache.find(first).isNull());
+    }
+};
+
+QTEST_GUILESS_MAIN(ResourceIconCacheTest)
+
+#include "ResourceIconCache_test.moc"
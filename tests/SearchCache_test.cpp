@@ -0,0 +1,111 @@
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <modplatform/helpers/SearchCache.h>
+
+class SearchCacheTest : public QObject {
+    Q_OBJECT
+
+    static ModPlatform::IndexedPack::Ptr makePack(const QString& id, const QString& name, const QString& description = {})
+    {
+        auto pack = std::make_shared<ModPlatform::IndexedPack>();
+        pack->addonId = id;
+        pack->provider = ModPlatform::ResourceProvider::MODRINTH;
+        pack->name = name;
+        pack->slug = id;
+        pack->description = description;
+        return pack;
+    }
+
+    static QStringList names(const QList<ModPlatform::IndexedPack::Ptr>& packs)
+    {
+        QStringList result;
+        for (auto& pack : packs)
+            result << pack->name;
+        return result;
+    }
+
+   private slots:
+    void test_Tokenize()
+    {
+        QCOMPARE(SearchCache::tokenize("Just Enough Items (JEI)"), QStringList({ "just", "enough", "items", "jei" }));
+        QCOMPARE(SearchCache::tokenize("  --  "), QStringList());
+    }
+
+    void test_FindPacks()
+    {
+        SearchCache cache({});
+        cache.insertPacks("mods", { makePack("a", "Sodium", "Modern rendering engine"), makePack("b", "Lithium", "Server optimization"),
+                                    makePack("c", "Indium", "Rendering API for Sodium") });
+
+        // Every word of the term has to prefix some word of the pack, and name matches come first
+        QCOMPARE(names(cache.findPacks("mods", "sod", 25)), QStringList({ "Sodium", "Indium" }));
+        QCOMPARE(names(cache.findPacks("mods", "render sod", 25)), QStringList({ "Indium", "Sodium" }));
+        QCOMPARE(names(cache.findPacks("mods", "optim", 25)), QStringList({ "Lithium" }));
+        QCOMPARE(names(cache.findPacks("mods", "sod", 1)), QStringList({ "Sodium" }));
+        QVERIFY(cache.findPacks("mods", "optifine", 25).isEmpty());
+        QVERIFY(cache.findPacks("resourcepacks", "sod", 25).isEmpty());
+
+        // Seeing a pack again replaces what was indexed for it
+        cache.insertPacks("mods", { makePack("b", "Lithium", "Game logic optimization") });
+        QCOMPARE(names(cache.findPacks("mods", "logic", 25)), QStringList({ "Lithium" }));
+        QVERIFY(cache.findPacks("mods", "server", 25).isEmpty());
+    }
+
+    void test_PackExpiry()
+    {
+        SearchCache cache({});
+        auto seen = QDateTime::currentDateTimeUtc();
+        cache.insertPacks("mods", { makePack("a", "Sodium") }, seen);
+
+        QCOMPARE(cache.findPacks("mods", "sodium", 25, seen.addSecs(60)).size(), 1);
+        QVERIFY(cache.findPacks("mods", "sodium", 25, seen.addSecs(SearchCache::s_pack_ttl.count() + 1)).isEmpty());
+    }
+
+    void test_FoundPacksAreCopies()
+    {
+        SearchCache cache({});
+        cache.insertPacks("mods", { makePack("a", "Sodium") });
+
+        auto found = cache.findPacks("mods", "sodium", 25);
+        QCOMPARE(found.size(), 1);
+        found.first()->versionsLoaded = true;
+
+        QVERIFY(!cache.findPacks("mods", "sodium", 25).first()->versionsLoaded);
+    }
+
+    void test_Pages()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        const QString url = "https://api.modrinth.com/v2/search?query=sodium";
+
+        {
+            SearchCache cache(dir.path());
+            QVERIFY(!cache.page(url, SearchCache::s_page_ttl).has_value());
+            cache.storePage(url, "{\"hits\":[]}");
+            QCOMPARE(cache.page(url, SearchCache::s_page_ttl).value(), QByteArray("{\"hits\":[]}"));
+        }
+
+        // A new cache finds it on disk, as long as it isn't too old
+        SearchCache cache(dir.path());
+        QCOMPARE(cache.page(url, SearchCache::s_page_ttl).value(), QByteArray("{\"hits\":[]}"));
+
+        auto files = QDir(dir.path()).entryInfoList({ "*.json" }, QDir::Files);
+        QCOMPARE(files.size(), 1);
+        QFile file(files.first().absoluteFilePath());
+        QVERIFY(file.open(QIODevice::ReadWrite));
+        QVERIFY(file.setFileTime(QDateTime::currentDateTimeUtc().addSecs(-3600), QFileDevice::FileModificationTime));
+        file.close();
+
+        SearchCache reopened(dir.path());
+        QVERIFY(!reopened.page(url, SearchCache::s_page_ttl).has_value());
+        QVERIFY(reopened.page(url, SearchCache::s_offline_ttl).has_value());
+    }
+};
+
+QTEST_GUILESS_MAIN(SearchCacheTest)
+
+#include "SearchCache_test.moc"
@@ -1,3 +1,4 @@
+#include <QSignalSpy>
 #include <QTest>
 #include <QThread>
 #include <QTimer>
@@ -7,6 +8,7 @@
 #include <tasks/SequentialTask.h>
 #include <tasks/Task.h>
 
+#include <algorithm>
 #include <array>
 
 /* Does nothing. Only used for testing. */
@@ -199,6 +201,50 @@ class TaskTest : public QObject {
         QVERIFY2(QTest::qWaitFor([&t]() { return t.isFinished(); }, 1000), "Task didn't finish as it should.");
     }
 
+    // Tests if tasks added while running fill all the free slots right away
+    void test_addWhileConcurrentRun()
+    {
+        ConcurrentTask t("", 3);
+
+        auto first = makeShared<BasicTask>();
+        // These never finish on their own, so they can only have started together
+        std::array<Task::Ptr, 3> added{ makeShared<BasicTask_MultiStep>(), makeShared<BasicTask_MultiStep>(),
+                                        makeShared<BasicTask_MultiStep>() };
+
+        QObject::connect(first.get(), &Task::succeeded, [&t, &added] {
+            for (auto& task : added)
+                t.addTask(task);
+        });
+        t.addTask(first);
+
+        t.start();
+        QVERIFY2(QTest::qWaitFor(
+                     [&added] { return std::all_of(added.begin(), added.end(), [](const Task::Ptr& task) { return task->isRunning(); }); },
+                     1000),
+                 "Tasks added while running didn't all start.");
+    }
+
+    // Tests if a subtask that's already running is waited for, instead of being started again
+    void test_sharedRunningSubTask()
+    {
+        auto shared = makeShared<BasicTask_MultiStep>();
+        shared->start();
+        QSignalSpy started(shared.get(), &Task::started);
+
+        SequentialTask t;
+        t.addTask(shared);
+        t.addTask(makeShared<BasicTask>());
+
+        t.start();
+        QTest::qWait(50);
+        QCOMPARE(started.count(), 0);
+        QVERIFY(!t.isFinished());
+
+        shared->emitSucceeded();
+        QVERIFY2(QTest::qWaitFor([&t]() { return t.isFinished(); }, 1000), "Task didn't finish as it should.");
+        QVERIFY(t.wasSuccessful());
+    }
+
     void test_basicSequentialRun()
     {
         auto t1 = makeShared<BasicTask>();
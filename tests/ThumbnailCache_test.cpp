@@ -0,0 +1,101 @@
+#include <QDateTime>
+#include <QTemporaryDir>
+#include <QTest>
+
+#include <FileSystem.h>
+#include <screenshots/ThumbnailCache.h>
+
+class ThumbnailCacheTest : public QObject {
+    Q_OBJECT
+
+    static QString writeScreenshot(const QString& dir, QSize size, QColor color)
+    {
+        QImage image(size, QImage::Format_RGB32);
+        image.fill(color);
+        auto path = FS::PathCombine(dir, "screenshot.png");
+        image.save(path, "png");
+        return path;
+    }
+
+   private slots:
+    void test_Generate()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ThumbnailCache cache(FS::PathCombine(dir.path(), "thumbnails"));
+
+        auto thumbnail = cache.generate(QFileInfo(writeScreenshot(dir.path(), QSize(1920, 1080), Qt::red)));
+        QCOMPARE(thumbnail.size(), QSize(256, 256));
+
+        // Wide images get letterboxed into the square
+        QCOMPARE(thumbnail.pixelColor(0, 0).alpha(), 0);
+        QCOMPARE(thumbnail.pixelColor(128, 128), QColor(Qt::red));
+
+        QVERIFY(cache.generate(QFileInfo(FS::PathCombine(dir.path(), "missing.png"))).isNull());
+    }
+
+    void test_StoreAndLoad()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ThumbnailCache cache(FS::PathCombine(dir.path(), "thumbnails"));
+
+        QFileInfo screenshot(writeScreenshot(dir.path(), QSize(640, 480), Qt::blue));
+        QVERIFY(cache.load(screenshot).isNull());
+
+        auto thumbnail = cache.generate(screenshot);
+        QVERIFY(cache.store(screenshot, thumbnail));
+        QVERIFY(QFileInfo::exists(cache.thumbnailPath(screenshot)));
+
+        auto loaded = cache.load(screenshot);
+        QCOMPARE(loaded.size(), thumbnail.size());
+        QCOMPARE(loaded.pixelColor(128, 128), QColor(Qt::blue));
+    }
+
+    void test_ChangedImage()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ThumbnailCache cache(FS::PathCombine(dir.path(), "thumbnails"));
+
+        QFileInfo screenshot(writeScreenshot(dir.path(), QSize(640, 480), Qt::blue));
+        QVERIFY(cache.store(screenshot, cache.generate(screenshot)));
+
+        // A different size alone is enough, even when the modification time didn't move
+        writeScreenshot(dir.path(), QSize(1600, 1200), Qt::green);
+        screenshot.refresh();
+        QVERIFY(cache.load(screenshot).isNull());
+    }
+
+    void test_Prune()
+    {
+        QTemporaryDir dir;
+        QVERIFY(dir.isValid());
+        ThumbnailCache cache(FS::PathCombine(dir.path(), "thumbnails"));
+
+        QFileInfo kept(writeScreenshot(dir.path(), QSize(640, 480), Qt::blue));
+        QVERIFY(cache.store(kept, cache.generate(kept)));
+
+        QFileInfo old(FS::PathCombine(dir.path(), "old.png"));
+        QVERIFY(QFile::copy(kept.absoluteFilePath(), old.absoluteFilePath()));
+        QVERIFY(cache.store(old, cache.generate(old)));
+        QFile thumbnail(cache.thumbnailPath(old));
+        QVERIFY(thumbnail.open(QIODevice::ReadWrite));
+        QVERIFY(thumbnail.setFileTime(QDateTime::currentDateTimeUtc().addDays(-60), QFileDevice::FileModificationTime));
+        thumbnail.close();
+
+        QFileInfo deleted(FS::PathCombine(dir.path(), "deleted.png"));
+        QVERIFY(QFile::copy(kept.absoluteFilePath(), deleted.absoluteFilePath()));
+        QVERIFY(cache.store(deleted, cache.generate(deleted)));
+        QVERIFY(QFile::remove(deleted.absoluteFilePath()));
+
+        cache.prune();
+        QVERIFY(QFileInfo::exists(cache.thumbnailPath(kept)));
+        QVERIFY(!QFileInfo::exists(cache.thumbnailPath(old)));
+        QVERIFY(!QFileInfo::exists(cache.thumbnailPath(deleted)));
+    }
+};
+
+QTEST_GUILESS_MAIN(ThumbnailCacheTest)
+
+#include "ThumbnailCache_test.moc"
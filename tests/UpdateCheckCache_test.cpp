@@ -0,0 +1,48 @@
+#include <QJsonObject>
+#include <QTest>
+
+#include <modplatform/helpers/UpdateCheckCache.h>
+
+class UpdateCheckCacheTest : public QObject {
+    Q_OBJECT
+
+   private slots:
+    void test_FindAnswers()
+    {
+        UpdateCheckCache cache;
+        auto fetched = QDateTime::currentDateTimeUtc();
+        QJsonObject version{ { "version_number", "1.2.3" } };
+        cache.insert(ModPlatform::ResourceProvider::MODRINTH, "abc", "1.20.1|fabric", version, fetched);
+
+        QCOMPARE(cache.find(ModPlatform::ResourceProvider::MODRINTH, "abc", "1.20.1|fabric", fetched).value(), QJsonValue(version));
+
+        // The same thing asked about in another context, or of another provider, is another question
+        QVERIFY(!cache.find(ModPlatform::ResourceProvider::MODRINTH, "abc", "1.20.1|forge", fetched).has_value());
+        QVERIFY(!cache.find(ModPlatform::ResourceProvider::FLAME, "abc", "1.20.1|fabric", fetched).has_value());
+    }
+
+    void test_EmptyAnswers()
+    {
+        UpdateCheckCache cache;
+        cache.insert(ModPlatform::ResourceProvider::FLAME, "123", "1.20.1", QJsonObject());
+
+        auto answer = cache.find(ModPlatform::ResourceProvider::FLAME, "123", "1.20.1");
+        QVERIFY(answer.has_value());
+        QVERIFY(answer->toObject().isEmpty());
+    }
+
+    void test_Expiry()
+    {
+        UpdateCheckCache cache;
+        auto fetched = QDateTime::currentDateTimeUtc();
+        cache.insert(ModPlatform::ResourceProvider::FLAME, "123", "1.20.1", QJsonObject{ { "files", 1 } }, fetched);
+
+        QVERIFY(cache.find(ModPlatform::ResourceProvider::FLAME, "123", "1.20.1", fetched.addSecs(60)).has_value());
+        QVERIFY(!cache.find(ModPlatform::ResourceProvider::FLAME, "123", "1.20.1", fetched.addSecs(UpdateCheckCache::s_ttl.count() + 1))
+                     .has_value());
+    }
+};
+
+QTEST_GUILESS_MAIN(UpdateCheckCacheTest)
+
+#include "UpdateCheckCache_test.moc"
@@ -15,6 +15,9 @@
 
 #include <QTest>
 
+#include <algorithm>
+#include <random>
+
 #include <Version.h>
 
 class VersionTest : public QObject {
@@ -178,6 +181,33 @@ class VersionTest : public QObject {
         QCOMPARE(v1 > v2, !lessThan && !equal);
         QCOMPARE(v1 == v2, equal);
     }
+
+    void test_sortForgeVersions()
+    {
+        // Shaped like the Forge list: a few thousand builds of each Minecraft version, some with a branch or build tag
+        QList<Version> versions;
+        for (int build = 0; build < 2000; build++) {
+            versions.append(Version(QString("14.23.5.%1").arg(build)));
+            versions.append(Version(QString("1.12.2-14.23.5.%1").arg(build)));
+            versions.append(Version(QString("47.2.%1").arg(build)));
+            if (build % 10 == 0)
+                versions.append(Version(QString("36.2.%1+mc1.16.5").arg(build)));
+            if (build % 25 == 0)
+                versions.append(Version(QString("10.13.4.%1-1.8.9").arg(build)));
+        }
+        std::shuffle(versions.begin(), versions.end(), std::mt19937(42));
+
+        QList<Version> sorted;
+        QBENCHMARK
+        {
+            sorted = versions;
+            std::sort(sorted.begin(), sorted.end());
+        }
+
+        QVERIFY(std::is_sorted(sorted.begin(), sorted.end()));
+        QCOMPARE(sorted.first(), Version("1.12.2-14.23.5.0"));
+        QCOMPARE(sorted.last(), Version("47.2.1999"));
+    }
 };
 
 QTEST_GUILESS_MAIN(VersionTest)